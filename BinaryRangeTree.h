@@ -18,35 +18,127 @@
 
 // Dependencies | std
 #include <set>
+#include <vector>
+#include <limits>
+#include <cstddef>
 #include <type_traits>
 #include <istream>
 #include <ostream>
 
 // Dependencies | utility
 #include "Range.h"
+#include "RangeCoalescer.h"
+
+// Forward declarations
+template <typename T> class BinaryRangeTreeParallel;
 
 template <typename T> class BinaryRangeTree {
 	// Static assert:
 	static_assert(std::is_integral<T>::value, "BinaryRangeTree requires an integral type."); 
 	
+	// Friends
+	friend class BinaryRangeTreeParallel<T>;
+
+	// Static
+	private:
+		// Functions
+		static void s_append(std::vector<Range<T>>& ranges, const Range<T>& range) {
+			// Append range, merging it into the last range when they overlap or are adjacent
+			if (!ranges.empty()) {
+				Range<T>& last = ranges.back();
+				if (last.x1 == std::numeric_limits<T>::max() || range.x0 <= last.x1 + 1) {
+					if (range.x1 > last.x1)
+						last.x1 = range.x1;
+					return;
+				}
+			}
+			ranges.push_back(range);
+		}
+		static std::vector<Range<T>> s_unite(const Range<T>* a, size_t aCount, const Range<T>* b, size_t bCount) {
+			std::vector<Range<T>> result{};
+			size_t i = 0, j = 0;
+			while (i < aCount || j < bCount) {
+				if (j == bCount || (i < aCount && a[i].x0 < b[j].x0))
+					s_append(result, a[i++]);
+				else
+					s_append(result, b[j++]);
+			}
+			return result;
+		}
+		static std::vector<Range<T>> s_intersect(const Range<T>* a, size_t aCount, const Range<T>* b, size_t bCount) {
+			std::vector<Range<T>> result{};
+			size_t i = 0, j = 0;
+			while (i < aCount && j < bCount) {
+				T x0 = a[i].x0 > b[j].x0 ? a[i].x0 : b[j].x0;
+				T x1 = a[i].x1 < b[j].x1 ? a[i].x1 : b[j].x1;
+				if (x0 <= x1)
+					s_append(result, { x0, x1 });
+				if (a[i].x1 < b[j].x1)
+					i++;
+				else
+					j++;
+			}
+			return result;
+		}
+		static std::vector<Range<T>> s_subtract(const Range<T>* a, size_t aCount, const Range<T>* b, size_t bCount) {
+			std::vector<Range<T>> result{};
+			size_t j = 0;
+			for (size_t i = 0; i < aCount; i++) {
+				Range<T> remaining{ a[i] };
+				bool isEmpty = false;
+				while (j < bCount && b[j].x1 < remaining.x0)
+					j++;
+				for (; j < bCount && b[j].x0 <= remaining.x1; j++) {
+					if (b[j].x0 > remaining.x0)
+						result.push_back({ remaining.x0, b[j].x0 - 1 });
+					if (b[j].x1 >= remaining.x1) {
+						isEmpty = true;
+						break; // b[j] may still cover the next range of a
+					}
+					remaining.x0 = b[j].x1 + 1;
+				}
+				if (!isEmpty)
+					result.push_back(remaining);
+			}
+			return result;
+		}
+		static BinaryRangeTree s_fromSortedRanges(const std::vector<Range<T>>& sortedRanges) {
+			BinaryRangeTree binaryRangeTree{};
+			for (const Range<T>& range : sortedRanges)
+				binaryRangeTree.ranges.insert(binaryRangeTree.ranges.end(), range);
+			return binaryRangeTree;
+		}
+
 	// Object
 	private:
 		// Properties
 		std::set<Range<T>> ranges{};
 
+		// Functions
+		void carve(typename std::set<Range<T>>::iterator iterator, const Range<T>& rangeToRemove) {
+			// Removes rangeToRemove, which must lie inside *iterator, keeping what is left on either side
+			Range<T> currentRange = *iterator;
+			typename std::set<Range<T>>::iterator hintIterator = std::next(iterator);
+			ranges.erase(iterator);
+			if (currentRange.x1 > rangeToRemove.x1)
+				hintIterator = ranges.insert(hintIterator, { rangeToRemove.x1 + 1, currentRange.x1 });
+			if (currentRange.x0 < rangeToRemove.x0)
+				ranges.insert(hintIterator, { currentRange.x0, rangeToRemove.x0 - 1 });
+		}
+
 	public:
 		// Constructor / Destructor
 		BinaryRangeTree() = default;
 		BinaryRangeTree(const Range<T>& range) : ranges(std::set<Range<T>>{ range }) {}
 		BinaryRangeTree(const std::set<Range<T>>& ranges) {
-			for (const Range<int>& range : ranges)
+			for (const Range<T>& range : ranges)
 				this->ranges.insert(range);
 		}
 		BinaryRangeTree(T x0, T x1) : BinaryRangeTree(Range<T>{ x0, x1 }) {
 
 		}
 		BinaryRangeTree(std::set<Range<T>>&& ranges) {
-			for (const Range<int> range : ranges)
+			for (const Range<T> range : ranges)
 				this->ranges.insert(range);
 			ranges.clear();
 		}
@@ -75,7 +167,7 @@ template <typename T> class BinaryRangeTree {
 		}
 		bool push(const Range<T>& range) {
 			Range<T> newRange{ range };
-			std::pair<std::set<Range<T>>::iterator, bool> result = ranges.insert(newRange);
+			std::pair<typename std::set<Range<T>>::iterator, bool> result = ranges.insert(newRange);
 
 			if (result.second == false)
 				return false;
@@ -136,29 +228,8 @@ template <typename T> class BinaryRangeTree {
 				return true;
 			}
 
-			Range<T> currentRange = *iteratorToRemove;
 			if (rangeToRemove.inside(*iteratorToRemove)) {
-				typename std::set<Range<T>>::iterator hintIterator = iteratorToRemove;
-				typename std::set<Range<T>>::iterator prev = ranges.end();
-				typename std::set<Range<T>>::iterator next = ranges.end();
-				if (iteratorToRemove != ranges.begin()) {
-					prev = std::prev(iteratorToRemove);
-					hintIterator = prev;
-				}
-				if (std::next(iteratorToRemove) != ranges.end()) {
-					next = std::next(iteratorToRemove);
-					hintIterator = next;
-				}
-
-				ranges.erase(iteratorToRemove);
-
-				bool createLeftNode{ currentRange.x0 < rangeToRemove.x0 };
-				bool createRightNode{ currentRange.x1 > rangeToRemove.x1 };
-				if (createLeftNode)
-					ranges.insert(hintIterator, { currentRange.x0, rangeToRemove.x0 - 1 });
-				if (createRightNode)
-					ranges.insert(hintIterator, { rangeToRemove.x1 + 1, currentRange.x1 });
-
+				carve(iteratorToRemove, rangeToRemove);
 				return true;
 			}
 
@@ -230,7 +301,7 @@ std::ostream& operator<<(std::ostream& ostream, const BinaryRangeTree<T>& binary
 // Operators | std::istream >>
 template <typename T>
 std::istream& operator>>(std::istream& istream, BinaryRangeTree<T>& binaryRangeTree) {
-	std::set<Range<T>> set{};
+	RangeCoalescer<T> rangeCoalescer{}; // Overlapping ranges are equivalent in std::set, so coalesce instead of inserting
 	char c{ 0 };
 	Range<T> range{};
 
@@ -244,7 +315,7 @@ std::istream& operator>>(std::istream& istream, BinaryRangeTree<T>& binaryRangeT
 		istream >> range;
 		if (!istream)
 			break;
-		set.insert(range);
+		rangeCoalescer.push(range);
 
 		istream >> std::ws >> c;
 		if (c == ']') {
@@ -256,6 +327,10 @@ std::istream& operator>>(std::istream& istream, BinaryRangeTree<T>& binaryRangeT
 		}
 	}
 
+	std::set<Range<T>> set{};
+	rangeCoalescer.flush();
+	while (rangeCoalescer.pop(&range))
+		set.insert(set.end(), range);
 	binaryRangeTree.setRanges(set);
 
 	return istream;
@@ -0,0 +1,245 @@
+/******************************************************************************
+ * Filename:    BinaryRangeTreeParallel.h
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: This header defines the BinaryRangeTreeParallel template class.
+ *              It provides parallel construction of and set operations on
+ *              sorted, disjoint ranges, taking a standard execution policy
+ *              (std::execution::seq / par / par_unseq). On GCC the parallel
+ *              policies require TBB (-ltbb).
+ *
+ *              The std::vector<Range<T>> overloads run every phase in
+ *              parallel: sort, per-chunk coalescing / merging, boundary
+ *              stitching and the final copy. Work is split into one chunk per
+ *              available thread (the TBB arena and tbb::global_control limit,
+ *              when TBB is present), each of at least MIN_CHUNK_SIZE elements;
+ *              std::execution::seq and small inputs run as a single chunk
+ *              with no splitting or stitching. The BinaryRangeTree overloads
+ *              add a serial std::set build (and, for set operations, a serial
+ *              copy of both inputs to vectors), which does not scale with
+ *              cores; keep data in vector form across operations when
+ *              throughput matters and convert to a tree once at the end.
+ *
+ * Usage:
+ *     std::vector<Range<int>> ranges = BinaryRangeTreeParallel<int>::coalesce(values.data(), values.size(), std::execution::par);
+ *     BinaryRangeTree<int> tree = BinaryRangeTreeParallel<int>::fromValues(values.data(), values.size(), std::execution::par);
+ *     BinaryRangeTree<int> both = BinaryRangeTreeParallel<int>::intersect(a, b, std::execution::par);
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+#pragma once
+
+// Dependencies | std
+#include <vector>
+#include <utility>
+#include <limits>
+#include <thread>
+#include <numeric>
+#include <algorithm>
+#include <execution>
+#include <cstddef>
+#include <type_traits>
+
+// Dependencies | TBB (thread limits of the arena and tbb::global_control, when the parallel policies run on TBB)
+#if __has_include(<tbb/task_arena.h>) && __has_include(<tbb/global_control.h>)
+#include <tbb/task_arena.h>
+#include <tbb/global_control.h>
+#define BINARY_RANGE_TREE_PARALLEL_HAS_TBB 1
+#else
+#define BINARY_RANGE_TREE_PARALLEL_HAS_TBB 0
+#endif
+
+// Dependencies | utility
+#include "Range.h"
+#include "BinaryRangeTree.h"
+
+template <typename T> class BinaryRangeTreeParallel {
+	// Static assert:
+	static_assert(std::is_integral<T>::value, "BinaryRangeTreeParallel requires an integral type.");
+
+	// Static
+	private:
+		// Properties
+		static const size_t MIN_CHUNK_SIZE = 1 << 14; // Values or ranges per chunk below which splitting costs more than it saves
+
+		// Types
+		typedef std::vector<Range<T>> (*SetOperation)(const Range<T>* a, size_t aCount, const Range<T>* b, size_t bCount);
+
+		// Functions
+		template <typename ExecutionPolicy>
+		static size_t s_chunkCount(ExecutionPolicy&&, size_t size) {
+			// Single-threaded policies run as one chunk; otherwise one chunk per available thread, each at least MIN_CHUNK_SIZE
+			typedef typename std::decay<ExecutionPolicy>::type Policy;
+#if defined(__cpp_lib_execution) && __cpp_lib_execution >= 201902L
+			constexpr bool isSingleThreaded = std::is_same<Policy, std::execution::sequenced_policy>::value || std::is_same<Policy, std::execution::unsequenced_policy>::value;
+#else
+			constexpr bool isSingleThreaded = std::is_same<Policy, std::execution::sequenced_policy>::value;
+#endif
+			if constexpr (isSingleThreaded) {
+				return 1;
+			}
+			else {
+#if BINARY_RANGE_TREE_PARALLEL_HAS_TBB
+				// Respect the current arena and tbb::global_control
+				size_t threadCount = static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+				size_t allowedThreadCount = tbb::global_control::active_value(tbb::global_control::max_allowed_parallelism);
+				if (allowedThreadCount < threadCount)
+					threadCount = allowedThreadCount;
+#else
+				size_t threadCount = std::thread::hardware_concurrency();
+#endif
+				size_t chunkCount = size / MIN_CHUNK_SIZE;
+				if (chunkCount > threadCount)
+					chunkCount = threadCount;
+				return chunkCount == 0 ? 1 : chunkCount;
+			}
+		}
+		static bool s_touches(const Range<T>& last, const Range<T>& range) {
+			return last.getX1() == std::numeric_limits<T>::max() || range.getX0() <= last.getX1() + 1;
+		}
+		static std::pair<const Range<T>*, size_t> s_span(const std::vector<Range<T>>& ranges, T x0, T x1) {
+			// Ranges that reach into x0..x1; ranges are disjoint and sorted, so x1 is sorted as well
+			const Range<T>* begin = ranges.data();
+			const Range<T>* end = begin + ranges.size();
+			const Range<T>* first = std::partition_point(begin, end, [x0](const Range<T>& range) { return range.getX1() < x0; });
+			const Range<T>* last = std::partition_point(first, end, [x1](const Range<T>& range) { return range.getX0() <= x1; });
+			return { first, static_cast<size_t>(last - first) };
+		}
+		static void s_clip(std::vector<Range<T>>& ranges, T x0, T x1) {
+			// Ranges are disjoint and sorted; only the ones at either end can reach outside x0..x1
+			while (!ranges.empty() && ranges.back().getX0() > x1)
+				ranges.pop_back();
+			size_t outsideCount = 0;
+			while (outsideCount < ranges.size() && ranges[outsideCount].getX1() < x0)
+				outsideCount++;
+			ranges.erase(ranges.begin(), ranges.begin() + outsideCount);
+			if (!ranges.empty()) {
+				ranges.front().setRange(ranges.front().getX0() > x0 ? ranges.front().getX0() : x0, ranges.front().getX1());
+				ranges.back().setRange(ranges.back().getX0(), ranges.back().getX1() < x1 ? ranges.back().getX1() : x1);
+			}
+		}
+		template <typename ExecutionPolicy>
+		static std::vector<Range<T>> s_stitch(ExecutionPolicy&& policy, std::vector<std::vector<Range<T>>>& pieces) {
+			if (pieces.size() == 1)
+				return std::move(pieces[0]);
+
+			// Merge ranges that touch across piece boundaries into the last range of the previous non-empty piece
+			std::vector<size_t> absorbedCounts(pieces.size(), 0);
+			std::vector<Range<T>>* previous = nullptr;
+			for (size_t i = 0; i < pieces.size(); i++) {
+				std::vector<Range<T>>& piece = pieces[i];
+				if (previous != nullptr) {
+					Range<T>& last = previous->back();
+					while (absorbedCounts[i] < piece.size() && s_touches(last, piece[absorbedCounts[i]])) {
+						if (piece[absorbedCounts[i]].getX1() > last.getX1())
+							last.setX1(piece[absorbedCounts[i]].getX1());
+						absorbedCounts[i]++;
+					}
+				}
+				if (absorbedCounts[i] < piece.size())
+					previous = &piece;
+			}
+
+			// Copy the remaining ranges of every piece to its offset concurrently
+			std::vector<size_t> offsets(pieces.size() + 1, 0);
+			for (size_t i = 0; i < pieces.size(); i++)
+				offsets[i + 1] = offsets[i] + pieces[i].size() - absorbedCounts[i];
+
+			std::vector<Range<T>> result(offsets.back());
+			std::vector<size_t> indices(pieces.size());
+			std::iota(indices.begin(), indices.end(), size_t{ 0 });
+			std::for_each(policy, indices.begin(), indices.end(), [&](size_t i) {
+				std::copy(pieces[i].begin() + absorbedCounts[i], pieces[i].end(), result.begin() + offsets[i]);
+			});
+			return result;
+		}
+		template <typename ExecutionPolicy>
+		static std::vector<Range<T>> s_apply(ExecutionPolicy&& policy, const std::vector<Range<T>>& a, const std::vector<Range<T>>& b, SetOperation setOperation) {
+			const std::vector<Range<T>>& larger = a.size() >= b.size() ? a : b;
+			size_t chunkCount = s_chunkCount(policy, a.size() + b.size());
+			if (chunkCount == 1)
+				return setOperation(a.data(), a.size(), b.data(), b.size());
+
+			// Split the key space at evenly spaced range starts of the larger input
+			std::vector<T> keys{ std::numeric_limits<T>::min() };
+			for (size_t i = 1; i < chunkCount; i++) {
+				T key = larger[i * larger.size() / chunkCount].getX0();
+				if (key > keys.back())
+					keys.push_back(key);
+			}
+
+			// Combine, concurrently and without copying the inputs, the ranges that reach into each piece of the key space.
+			// Set operations are pointwise, so clipping the result to the piece equals combining clipped inputs
+			std::vector<std::vector<Range<T>>> pieces(keys.size());
+			std::vector<size_t> indices(keys.size());
+			std::iota(indices.begin(), indices.end(), size_t{ 0 });
+			std::for_each(policy, indices.begin(), indices.end(), [&](size_t i) {
+				T x0 = keys[i];
+				T x1 = i + 1 < keys.size() ? keys[i + 1] - 1 : std::numeric_limits<T>::max();
+				std::pair<const Range<T>*, size_t> aSpan = s_span(a, x0, x1);
+				std::pair<const Range<T>*, size_t> bSpan = s_span(b, x0, x1);
+				pieces[i] = setOperation(aSpan.first, aSpan.second, bSpan.first, bSpan.second);
+				s_clip(pieces[i], x0, x1);
+			});
+
+			return s_stitch(policy, pieces);
+		}
+		static std::vector<Range<T>> s_toVector(const BinaryRangeTree<T>& binaryRangeTree) {
+			return std::vector<Range<T>>(binaryRangeTree.ranges.begin(), binaryRangeTree.ranges.end());
+		}
+
+	public:
+		// Functions
+		template <typename ExecutionPolicy>
+		static std::vector<Range<T>> coalesce(const T* values, size_t count, ExecutionPolicy&& policy) {
+			// Sort a copy only if the input is not sorted already
+			std::vector<T> sortedValues{};
+			if (!std::is_sorted(policy, values, values + count)) {
+				sortedValues.assign(values, values + count);
+				std::sort(policy, sortedValues.begin(), sortedValues.end());
+				values = sortedValues.data();
+			}
+
+			// Coalesce runs of consecutive values per chunk
+			size_t chunkCount = s_chunkCount(policy, count);
+			std::vector<std::vector<Range<T>>> pieces(chunkCount);
+			std::vector<size_t> indices(chunkCount);
+			std::iota(indices.begin(), indices.end(), size_t{ 0 });
+			std::for_each(policy, indices.begin(), indices.end(), [&](size_t i) {
+				size_t end = (i + 1) * count / chunkCount;
+				for (size_t j = i * count / chunkCount; j < end; j++)
+					BinaryRangeTree<T>::s_append(pieces[i], { values[j], values[j] });
+			});
+
+			return s_stitch(policy, pieces);
+		}
+		template <typename ExecutionPolicy>
+		static BinaryRangeTree<T> fromValues(const T* values, size_t count, ExecutionPolicy&& policy) {
+			return BinaryRangeTree<T>::s_fromSortedRanges(coalesce(values, count, policy));
+		}
+		template <typename ExecutionPolicy>
+		static std::vector<Range<T>> unite(const std::vector<Range<T>>& a, const std::vector<Range<T>>& b, ExecutionPolicy&& policy) {
+			return s_apply(policy, a, b, &BinaryRangeTree<T>::s_unite);
+		}
+		template <typename ExecutionPolicy>
+		static std::vector<Range<T>> intersect(const std::vector<Range<T>>& a, const std::vector<Range<T>>& b, ExecutionPolicy&& policy) {
+			return s_apply(policy, a, b, &BinaryRangeTree<T>::s_intersect);
+		}
+		template <typename ExecutionPolicy>
+		static std::vector<Range<T>> subtract(const std::vector<Range<T>>& a, const std::vector<Range<T>>& b, ExecutionPolicy&& policy) {
+			return s_apply(policy, a, b, &BinaryRangeTree<T>::s_subtract);
+		}
+		template <typename ExecutionPolicy>
+		static BinaryRangeTree<T> unite(const BinaryRangeTree<T>& a, const BinaryRangeTree<T>& b, ExecutionPolicy&& policy) {
+			return BinaryRangeTree<T>::s_fromSortedRanges(unite(s_toVector(a), s_toVector(b), policy));
+		}
+		template <typename ExecutionPolicy>
+		static BinaryRangeTree<T> intersect(const BinaryRangeTree<T>& a, const BinaryRangeTree<T>& b, ExecutionPolicy&& policy) {
+			return BinaryRangeTree<T>::s_fromSortedRanges(intersect(s_toVector(a), s_toVector(b), policy));
+		}
+		template <typename ExecutionPolicy>
+		static BinaryRangeTree<T> subtract(const BinaryRangeTree<T>& a, const BinaryRangeTree<T>& b, ExecutionPolicy&& policy) {
+			return BinaryRangeTree<T>::s_fromSortedRanges(subtract(s_toVector(a), s_toVector(b), policy));
+		}
+};
@@ -13,17 +13,94 @@ const char Number::MAX_DIGIT_COUNT = 18;
 const char Number::MAX_WHOLE_DIGIT_COUNT = 10;
 const char Number::MAX_DECIMAL_DIGIT_COUNT = 8;
 
+// Helpers
+
+// Computes (a * 10^MAX_DECIMAL_DIGIT_COUNT) / b on magnitudes without overflowing the intermediate product.
+// Returns false if the quotient is greater than limit.
+static bool s_divideScaled(unsigned long long a, unsigned long long b, unsigned long long limit, unsigned long long* result) {
+	unsigned long long quotient = a / b;
+	unsigned long long remainder = a % b;
+
+	// Long division, one decimal digit at a time
+	for (char i = 0; i < Number::MAX_DECIMAL_DIGIT_COUNT; i++) {
+		unsigned long long digit = 0ULL;
+		if (remainder <= std::numeric_limits<unsigned long long>::max() / 10ULL) {
+			digit = remainder * 10ULL / b;
+			remainder = remainder * 10ULL % b;
+		}
+		else {
+			// remainder * 10 does not fit, so add remainder ten times modulo b
+			unsigned long long next = 0ULL;
+			for (char j = 0; j < 10; j++) {
+				if (next >= b - remainder) {
+					next -= b - remainder;
+					digit++;
+				}
+				else {
+					next += remainder;
+				}
+			}
+			remainder = next;
+		}
+
+		if (quotient > (limit - digit) / 10ULL)
+			return false; // Fail: quotient exceeds limit
+		quotient = quotient * 10ULL + digit;
+	}
+
+	*result = quotient;
+	return true;
+}
+// Computes (a * b) / 10^MAX_DECIMAL_DIGIT_COUNT on magnitudes without overflowing the intermediate product.
+// Returns false if the result is greater than limit.
+static bool s_multiplyScaled(unsigned long long a, unsigned long long b, unsigned long long limit, unsigned long long* result) {
+	const unsigned long long scale = 100000000ULL;
+
+	// a * b / scale = aWhole * bWhole * scale + aWhole * bDecimal + aDecimal * bWhole + aDecimal * bDecimal / scale
+	unsigned long long aWhole = a / scale;
+	unsigned long long aDecimal = a % scale;
+	unsigned long long bWhole = b / scale;
+	unsigned long long bDecimal = b % scale;
+
+	unsigned long long terms[4] = { 0ULL, 0ULL, 0ULL, aDecimal * bDecimal / scale };
+	if (aWhole != 0ULL && bWhole > limit / aWhole)
+		return false; // Fail: product exceeds limit
+	terms[0] = aWhole * bWhole;
+	if (terms[0] > limit / scale)
+		return false; // Fail: product exceeds limit
+	terms[0] *= scale;
+	if (aWhole != 0ULL && bDecimal > limit / aWhole)
+		return false; // Fail: product exceeds limit
+	terms[1] = aWhole * bDecimal;
+	if (bWhole != 0ULL && aDecimal > limit / bWhole)
+		return false; // Fail: product exceeds limit
+	terms[2] = aDecimal * bWhole;
+
+	unsigned long long sum = 0ULL;
+	for (unsigned long long term : terms) {
+		if (term > limit - sum)
+			return false; // Fail: product exceeds limit
+		sum += term;
+	}
+
+	*result = sum;
+	return true;
+}
+static unsigned long long s_magnitude(long long value) {
+	return value < 0LL ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+}
+
 // Functions
 bool Number::s_isAdditionSafe(const Number& a, const Number& b) {
-	// Positive underflow: a - b < LLONG_MIN
+	// Positive overflow: a + b > LLONG_MAX
 	if (b.value > 0LL && a.value > std::numeric_limits<long long>::max() - b.value)
-		return true;
+		return false;
 
-	// Negative overflow: a - b > LLONG_MAX
+	// Negative underflow: a + b < LLONG_MIN
 	if (b.value < 0LL && a.value < std::numeric_limits<long long>::min() - b.value)
-		return true;
+		return false;
 
-	return false; // Safe
+	return true; // Safe
 }
 bool Number::s_isSubtractionSafe(const Number& a, const Number& b) {
 	// Positive underflow: a - b < LLONG_MIN
@@ -37,38 +114,22 @@ bool Number::s_isSubtractionSafe(const Number& a, const Number& b) {
 	return true; // Safe
 }
 bool Number::s_isMultiplicationSafe(const Number& a, const Number& b) {
-	// Handle 0 early  always safe
-	if (a.value == 0 || b.value == 0)
-		return true;
-
-	// Check for overflow or underflow
-	if (a.value > 0) {
-		if (b.value > 0) {
-			return a.value <= std::numeric_limits<long long>::max() / b.value;
-		}
-		else {
-			return b.value >= std::numeric_limits<long long>::min() / a.value;
-		}
-	}
-	else {
-		if (b.value > 0) {
-			return a.value >= std::numeric_limits<long long>::min() / b.value;
-		}
-		else {
-			return a.value == 0 || b.value >= std::numeric_limits<long long>::max() / a.value;
-		}
-	}
+	// The product is scaled back by 10^MAX_DECIMAL_DIGIT_COUNT, so only the scaled result has to fit
+	bool isNegative = (a.value < 0LL) != (b.value < 0LL);
+	unsigned long long limit = s_magnitude(std::numeric_limits<long long>::max()) + (isNegative ? 1ULL : 0ULL);
+	unsigned long long result = 0ULL;
+	return s_multiplyScaled(s_magnitude(a.value), s_magnitude(b.value), limit, &result);
 }
 bool Number::s_isDivisionSafe(const Number& a, const Number& b) {
 	// Division by zero is always unsafe
 	if (b.value == 0)
 		return false;
 
-	// Special case: LLONG_MIN / -1 causes overflow
-	if (a.value == std::numeric_limits<long long>::min() && b.value == -1)
-		return false;
-
-	return true; // Safe division
+	// The quotient is scaled by 10^MAX_DECIMAL_DIGIT_COUNT, so it overflows well before LLONG_MIN / -1 does
+	bool isNegative = (a.value < 0LL) != (b.value < 0LL);
+	unsigned long long limit = s_magnitude(std::numeric_limits<long long>::max()) + (isNegative ? 1ULL : 0ULL);
+	unsigned long long result = 0ULL;
+	return s_divideScaled(s_magnitude(a.value), s_magnitude(b.value), limit, &result);
 }
 
 // Object | public
@@ -93,7 +154,7 @@ bool Number::setValue(const std::string& value) {
 	for (size_t i = 0; i < value.size(); i++) {
 		char c = value[i];
 
-		if (std::isdigit(c)) {
+		if (std::isdigit(static_cast<unsigned char>(c))) {
 			if (decimalPointPresent)
 				decimalDigitCount++;
 			else
@@ -134,11 +195,13 @@ bool Number::setValue(double value) {
 
 // Functions
 std::string Number::to_string() const {
-	std::string string = std::to_string(value);
-	if (string.size() == 8)
-		string = "0." + string;
-	else if (string.size() > 8)
-		string.insert(string.end() - 8, '.');
+	// Format the magnitude so the sign does not count as a digit
+	std::string string = std::to_string(s_magnitude(value));
+	if (string.size() <= static_cast<size_t>(MAX_DECIMAL_DIGIT_COUNT))
+		string.insert(0, MAX_DECIMAL_DIGIT_COUNT + 1 - string.size(), '0'); // Pad with leading zeroes up to "0.xxxxxxxx"
+	string.insert(string.end() - MAX_DECIMAL_DIGIT_COUNT, '.');
+	if (value < 0LL)
+		string.insert(string.begin(), '-');
 	return string;
 }
 bool Number::isSigned() const {
@@ -147,29 +210,32 @@ bool Number::isSigned() const {
 
 // Operators
 Number Number::operator+(const Number& other) const {
+	if (!s_isAdditionSafe(*this, other)) {
+		// Overflow is undefined, so return a default-constructed Number (0.0).
+		return Number();
+	}
 	return Number(value + other.value);
 }
 Number Number::operator-(const Number& other) const {
+	if (!s_isSubtractionSafe(*this, other)) {
+		// Overflow is undefined, so return a default-constructed Number (0.0).
+		return Number();
+	}
 	return Number(value - other.value);
 }
 Number Number::operator*(const Number& other) const {
-	if (other.value == 0LL)
+	// Multiply magnitudes so value * other.value never has to fit in a long long
+	bool isNegative = (value < 0LL) != (other.value < 0LL);
+	unsigned long long limit = s_magnitude(std::numeric_limits<long long>::max()) + (isNegative ? 1ULL : 0ULL);
+	unsigned long long resultMagnitude = 0ULL;
+	if (!s_multiplyScaled(s_magnitude(value), s_magnitude(other.value), limit, &resultMagnitude)) {
+		// Overflow is undefined, so return a default-constructed Number (0.0).
 		return Number();
+	}
 
-	long long thisWholePart = value / 100000000LL;
-	long long thisDecimalPart = value % 100000000LL;
-
-	long long otherWholePart = other.value / 100000000LL;
-	long long otherDecimalPart = other.value % 100000000LL;
-
-	long long resultWholePart = thisWholePart * otherWholePart;
-	long long resultDecimalPart = 0LL;
-	if (other.value != 0LL)
-		resultDecimalPart = thisWholePart * otherDecimalPart + otherWholePart * thisDecimalPart + (thisDecimalPart * otherDecimalPart) / 100000000LL;
-
-	long long result = resultWholePart * 100000000LL + resultDecimalPart;
-
-	return Number(result);
+	if (isNegative)
+		return Number(resultMagnitude == 0ULL ? 0LL : -static_cast<long long>(resultMagnitude - 1ULL) - 1LL);
+	return Number(static_cast<long long>(resultMagnitude));
 }
 Number Number::operator/(const Number& other) const {
 	if (other.value == 0LL) {
@@ -177,24 +243,25 @@ Number Number::operator/(const Number& other) const {
 		return Number();
 	}
 
-	// Find the common scale for both numbers
-	long long commonScale = 100000000LL;
-
-	// Convert both numbers to the common scale
-	long long thisScaled = value * (100000000LL / commonScale);
-	long long otherScaled = other.value * (100000000LL / commonScale);
-
-	// Perform the division
-	long long resultScaled = (thisScaled * commonScale) / otherScaled;
+	// Divide magnitudes so value * 10^8 never has to fit in a long long
+	bool isNegative = (value < 0LL) != (other.value < 0LL);
+	unsigned long long limit = s_magnitude(std::numeric_limits<long long>::max()) + (isNegative ? 1ULL : 0ULL);
+	unsigned long long resultMagnitude = 0ULL;
+	if (!s_divideScaled(s_magnitude(value), s_magnitude(other.value), limit, &resultMagnitude)) {
+		// Overflow is undefined as well, so return a default-constructed Number (0.0).
+		return Number();
+	}
 
-	return Number(resultScaled);
+	if (isNegative)
+		return Number(resultMagnitude == 0ULL ? 0LL : -static_cast<long long>(resultMagnitude - 1ULL) - 1LL);
+	return Number(static_cast<long long>(resultMagnitude));
 }
 Number& Number::operator+=(const Number& other) {
-	value += other.value;
+	value = (*this + other).value;
 	return *this;
 }
 Number& Number::operator-=(const Number& other) {
-	value -= other.value;
+	value = (*this - other).value;
 	return *this;
 }
 Number& Number::operator*=(const Number& other) {
@@ -114,14 +114,14 @@ template <typename T> class Range {
 			return Range{ x0 < other.x0 ? x0 : other.x0, x1 > other.x1 ? x1 : other.x1 };
 		}
 		std::string toString() const {
-			return "[" + x0 + ", " + x1 + "]";
+			return "[" + std::to_string(x0) + ", " + std::to_string(x1) + "]";
 		}
 };
 
 // Operators | std::ostream <<
 template <typename T>
 std::ostream& operator<<(std::ostream& os, const Range<T> range) {
-	return os << toString();
+	return os << range.toString();
 }
 
 // Operators | std::istream >>
@@ -0,0 +1,393 @@
+/******************************************************************************
+ * Filename:    RangeAllocator.h
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: This header defines the RangeAllocator template class.
+ *              It is a free-space map of ordered, non-overlapping integral
+ *              ranges (like BinaryRangeTree) for handing out contiguous
+ *              extents. Ranges are kept in a treap whose nodes store the
+ *              longest range in their subtree, so first-fit, near-hint and
+ *              best-fit allocations all run in O(log n) regardless of how
+ *              fragmented the free space is. Batch popLeast(count) lives here
+ *              as well; BinaryRangeTree stays a plain range set.
+ *
+ * Usage:
+ *     RangeAllocator<int> rangeAllocator(BinaryRangeTree<int>{ 0, 1023 });
+ *     int x0;
+ *     rangeAllocator.allocateContiguous(16, RangeAllocationStrategy::BEST_FIT, &x0); // Removes [x0, x0 + 15]
+ *     rangeAllocator.push({ x0, x0 + 15 }); // Frees them again
+ *     std::vector<Range<int>> poppedRanges;
+ *     rangeAllocator.popLeast(64, &poppedRanges); // Removes the 64 least values
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+#pragma once
+
+// Dependencies | std
+#include <set>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Dependencies | utility
+#include "Range.h"
+#include "BinaryRangeTree.h"
+
+// Strategies for RangeAllocator::allocateContiguous
+enum class RangeAllocationStrategy {
+	FIRST_FIT, // Lowest range that fits
+	BEST_FIT, // Shortest range that fits
+	NEAR_HINT // Range that fits closest to the hint
+};
+
+template <typename T> class RangeAllocator {
+	// Static assert:
+	static_assert(std::is_integral<T>::value, "RangeAllocator requires an integral type.");
+
+	// Static
+	public:
+		// Types
+		typedef typename std::make_unsigned<T>::type Length; // x1 - x0 without signed overflow
+
+	private:
+		// Properties
+		static const size_t NIL = std::numeric_limits<size_t>::max();
+
+		// Types
+		struct Node {
+			T x0{};
+			T x1{};
+			Length maxLength{}; // Longest x1 - x0 in this subtree
+			uint32_t priority{};
+			size_t left{ NIL };
+			size_t right{ NIL };
+		};
+
+		// Functions
+		static Length s_length(T x0, T x1) {
+			return static_cast<Length>(static_cast<Length>(x1) - static_cast<Length>(x0));
+		}
+		static T s_advance(T value, Length offset) {
+			return static_cast<T>(static_cast<Length>(static_cast<Length>(value) + offset));
+		}
+		static T s_retreat(T value, Length offset) {
+			return static_cast<T>(static_cast<Length>(static_cast<Length>(value) - offset));
+		}
+
+	// Object
+	private:
+		// Properties
+		std::vector<Node> nodes{}; // Node pool, indexed by size_t so the allocator stays copyable
+		std::vector<size_t> freeNodes{};
+		size_t root{ NIL };
+		std::set<std::pair<Length, T>> lengths{}; // (x1 - x0, x0) of every range, ordered by length for best-fit queries
+		uint32_t randomState{ 2463534242U };
+
+		// Functions | nodes
+		size_t createNode(T x0, T x1) {
+			// xorshift32 priorities keep the treap balanced in expectation
+			randomState ^= randomState << 13;
+			randomState ^= randomState >> 17;
+			randomState ^= randomState << 5;
+
+			size_t node = NIL;
+			if (freeNodes.empty()) {
+				node = nodes.size();
+				nodes.push_back(Node{});
+			}
+			else {
+				node = freeNodes.back();
+				freeNodes.pop_back();
+				nodes[node] = Node{};
+			}
+			nodes[node].x0 = x0;
+			nodes[node].x1 = x1;
+			nodes[node].maxLength = s_length(x0, x1);
+			nodes[node].priority = randomState;
+			lengths.insert({ s_length(x0, x1), x0 });
+			return node;
+		}
+		void destroyNode(size_t node) {
+			lengths.erase({ s_length(nodes[node].x0, nodes[node].x1), nodes[node].x0 });
+			freeNodes.push_back(node);
+		}
+		bool fits(size_t node, Length length) const {
+			return node != NIL && nodes[node].maxLength >= length;
+		}
+		void update(size_t node) {
+			Node& current = nodes[node];
+			current.maxLength = s_length(current.x0, current.x1);
+			if (current.left != NIL && nodes[current.left].maxLength > current.maxLength)
+				current.maxLength = nodes[current.left].maxLength;
+			if (current.right != NIL && nodes[current.right].maxLength > current.maxLength)
+				current.maxLength = nodes[current.right].maxLength;
+		}
+
+		// Functions | treap
+		void split(size_t node, T key, size_t* left, size_t* right) {
+			// left receives the ranges with x0 < key, right the ranges with x0 >= key
+			if (node == NIL) {
+				*left = NIL;
+				*right = NIL;
+				return;
+			}
+			if (nodes[node].x0 < key) {
+				size_t rightOfNode = NIL;
+				split(nodes[node].right, key, &rightOfNode, right);
+				nodes[node].right = rightOfNode;
+				*left = node;
+			}
+			else {
+				size_t leftOfNode = NIL;
+				split(nodes[node].left, key, left, &leftOfNode);
+				nodes[node].left = leftOfNode;
+				*right = node;
+			}
+			update(node);
+		}
+		size_t merge(size_t left, size_t right) {
+			// Every range in left lies before every range in right
+			if (left == NIL)
+				return right;
+			if (right == NIL)
+				return left;
+			if (nodes[left].priority > nodes[right].priority) {
+				nodes[left].right = merge(nodes[left].right, right);
+				update(left);
+				return left;
+			}
+			nodes[right].left = merge(left, nodes[right].left);
+			update(right);
+			return right;
+		}
+		size_t removeLeftmost(size_t node, size_t* removed) {
+			if (nodes[node].left == NIL) {
+				*removed = node;
+				return nodes[node].right;
+			}
+			nodes[node].left = removeLeftmost(nodes[node].left, removed);
+			update(node);
+			return node;
+		}
+		size_t removeRightmost(size_t node, size_t* removed) {
+			if (nodes[node].right == NIL) {
+				*removed = node;
+				return nodes[node].left;
+			}
+			nodes[node].right = removeRightmost(nodes[node].right, removed);
+			update(node);
+			return node;
+		}
+		size_t leftmost(size_t node) const {
+			if (node != NIL)
+				while (nodes[node].left != NIL)
+					node = nodes[node].left;
+			return node;
+		}
+		size_t rightmost(size_t node) const {
+			if (node != NIL)
+				while (nodes[node].right != NIL)
+					node = nodes[node].right;
+			return node;
+		}
+		size_t find(T x0) const {
+			size_t node = root;
+			while (node != NIL && nodes[node].x0 != x0)
+				node = x0 < nodes[node].x0 ? nodes[node].left : nodes[node].right;
+			return node;
+		}
+		size_t firstFit(size_t node, Length length) const {
+			// Lowest range in the subtree with x1 - x0 >= length
+			while (fits(node, length)) {
+				if (fits(nodes[node].left, length))
+					node = nodes[node].left;
+				else if (s_length(nodes[node].x0, nodes[node].x1) >= length)
+					return node;
+				else
+					node = nodes[node].right;
+			}
+			return NIL;
+		}
+		size_t lastFit(size_t node, Length length) const {
+			// Greatest range in the subtree with x1 - x0 >= length
+			while (fits(node, length)) {
+				if (fits(nodes[node].right, length))
+					node = nodes[node].right;
+				else if (s_length(nodes[node].x0, nodes[node].x1) >= length)
+					return node;
+				else
+					node = nodes[node].left;
+			}
+			return NIL;
+		}
+		void insertDisjoint(T x0, T x1) {
+			// x0..x1 must neither overlap nor touch any stored range
+			size_t left = NIL;
+			size_t right = NIL;
+			split(root, x0, &left, &right);
+			root = merge(merge(left, createNode(x0, x1)), right);
+		}
+		void erase(T x0) {
+			size_t left = NIL;
+			size_t right = NIL;
+			size_t removed = NIL;
+			split(root, x0, &left, &right);
+			right = removeLeftmost(right, &removed);
+			destroyNode(removed);
+			root = merge(left, right);
+		}
+		void carve(size_t node, T x0, T x1) {
+			// Removes x0..x1, which must lie inside node, keeping what is left on either side
+			T nodeX0 = nodes[node].x0;
+			T nodeX1 = nodes[node].x1;
+			erase(nodeX0);
+			if (nodeX0 < x0)
+				insertDisjoint(nodeX0, x0 - 1);
+			if (nodeX1 > x1)
+				insertDisjoint(x1 + 1, nodeX1);
+		}
+		void collect(size_t node, std::set<Range<T>>* ranges) const {
+			if (node == NIL)
+				return;
+			collect(nodes[node].left, ranges);
+			ranges->insert(ranges->end(), Range<T>{ nodes[node].x0, nodes[node].x1 });
+			collect(nodes[node].right, ranges);
+		}
+
+	public:
+		// Constructor / Destructor
+		RangeAllocator() = default;
+		RangeAllocator(const BinaryRangeTree<T>& binaryRangeTree) {
+			for (const Range<T>& range : binaryRangeTree.getRanges())
+				push(range);
+		}
+		~RangeAllocator() = default;
+
+		// Getters
+		size_t size() const {
+			return nodes.size() - freeNodes.size();
+		}
+		bool empty() const {
+			return root == NIL;
+		}
+		std::set<Range<T>> getRanges() const {
+			std::set<Range<T>> ranges{};
+			collect(root, &ranges);
+			return ranges;
+		}
+		BinaryRangeTree<T> toBinaryRangeTree() const {
+			return BinaryRangeTree<T>{ getRanges() };
+		}
+
+		// Functions
+		bool push(T value) {
+			return push(Range<T>{ value, value });
+		}
+		bool push(const Range<T>& range) {
+			// Frees range, merging it with adjacent ranges; fails if any of it is already free
+			T x0 = range.getX0();
+			T x1 = range.getX1();
+			size_t left = NIL;
+			size_t right = NIL;
+			split(root, x0, &left, &right);
+
+			size_t previous = rightmost(left);
+			size_t next = leftmost(right);
+			if ((previous != NIL && nodes[previous].x1 >= x0) || (next != NIL && nodes[next].x0 <= x1)) {
+				root = merge(left, right);
+				return false; // Fail: range overlaps free space
+			}
+
+			size_t removed = NIL;
+			if (previous != NIL && nodes[previous].x1 + 1 == x0) {
+				x0 = nodes[previous].x0;
+				left = removeRightmost(left, &removed);
+				destroyNode(removed);
+			}
+			if (next != NIL && x1 + 1 == nodes[next].x0) {
+				x1 = nodes[next].x1;
+				right = removeLeftmost(right, &removed);
+				destroyNode(removed);
+			}
+
+			root = merge(merge(left, createNode(x0, x1)), right);
+			return true;
+		}
+		bool allocateContiguous(Length count, RangeAllocationStrategy strategy, T* x0, T hint = T{}) {
+			Length length = count - 1; // x1 - x0 of the allocation
+			if (count == 0 || !fits(root, length))
+				return false; // Fail: no range is long enough
+
+			size_t node = NIL;
+			T allocationX0{};
+			switch (strategy) {
+				case RangeAllocationStrategy::FIRST_FIT: {
+					node = firstFit(root, length);
+					allocationX0 = nodes[node].x0;
+					break;
+				}
+				case RangeAllocationStrategy::BEST_FIT: {
+					node = find(lengths.lower_bound({ length, std::numeric_limits<T>::min() })->second);
+					allocationX0 = nodes[node].x0;
+					break;
+				}
+				case RangeAllocationStrategy::NEAR_HINT: {
+					// Greatest fitting range starting before the hint and least fitting range starting at or after it
+					size_t left = NIL;
+					size_t right = NIL;
+					split(root, hint, &left, &right);
+					size_t before = lastFit(left, length);
+					size_t after = firstFit(right, length);
+					root = merge(left, right);
+
+					// Allocate as close to the hint as the range allows
+					T beforeX0{};
+					if (before != NIL) {
+						T lastX0 = s_retreat(nodes[before].x1, length);
+						beforeX0 = hint < lastX0 ? hint : lastX0;
+					}
+					if (before != NIL && (after == NIL || s_length(beforeX0, hint) <= s_length(hint, nodes[after].x0))) {
+						node = before;
+						allocationX0 = beforeX0;
+					}
+					else {
+						node = after;
+						allocationX0 = nodes[after].x0;
+					}
+					break;
+				}
+			}
+
+			carve(node, allocationX0, s_advance(allocationX0, length));
+			if (x0 != nullptr)
+				*x0 = allocationX0;
+			return true;
+		}
+		Length popLeast(Length count, std::vector<Range<T>>* poppedRanges) {
+			// Pops up to count of the least values, a whole range at a time where possible
+			Length poppedCount = 0;
+			while (poppedCount < count && root != NIL) {
+				size_t least = leftmost(root);
+				T x0 = nodes[least].x0;
+				T x1 = nodes[least].x1;
+				if (s_length(x0, x1) >= count - poppedCount)
+					x1 = s_advance(x0, count - poppedCount - 1);
+				carve(least, x0, x1);
+
+				poppedCount += s_length(x0, x1) + 1;
+				if (poppedRanges != nullptr)
+					poppedRanges->push_back(Range<T>{ x0, x1 });
+			}
+			return poppedCount;
+		}
+		void clear() {
+			nodes.clear();
+			freeNodes.clear();
+			lengths.clear();
+			root = NIL;
+		}
+};
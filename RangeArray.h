@@ -0,0 +1,199 @@
+/******************************************************************************
+ * Filename:    RangeArray.h
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: This header defines the RangeArray template class.
+ *              It stores ranges as a structure of arrays (one column of x0
+ *              and one column of x1) so that a query range can be tested
+ *              against large numbers of ranges at once. The kernels are
+ *              branchless loops over contiguous columns. On x86 Linux with
+ *              GCC or Clang they are built for AVX-512, AVX2 and baseline
+ *              x86-64 (target_clones) and the best one for the running CPU
+ *              is picked at load time; GCC is also told to vectorize them at
+ *              -O2. Define RANGE_ARRAY_NO_DISPATCH to build only the default
+ *              version. See bench/RangeArrayBenchmark.cpp for timings.
+ *
+ * Usage:
+ *     RangeArray<int> rangeArray;
+ *     rangeArray.push({ -5, 10 });
+ *     rangeArray.overlapsAny({ 0, 3 });
+ *     rangeArray.countOverlaps({ 0, 3 });
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+#pragma once
+
+// Dependencies | std
+#include <vector>
+#include <set>
+#include <utility>
+#include <algorithm>
+#include <limits>
+#include <cstddef>
+
+// Dependencies | utility
+#include "Range.h"
+#include "BinaryRangeTree.h"
+
+// Kernel dispatch: one clone per instruction set, resolved once through an ifunc
+#if !defined(RANGE_ARRAY_NO_DISPATCH) && defined(__linux__) && (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) && !defined(__clang__)
+#define RANGE_ARRAY_KERNEL __attribute__((target_clones("avx512f", "avx2", "default"), optimize("tree-vectorize", "vect-cost-model=dynamic")))
+#elif !defined(RANGE_ARRAY_NO_DISPATCH) && defined(__linux__) && (defined(__x86_64__) || defined(__i386__)) && defined(__clang__) && __clang_major__ >= 14
+#define RANGE_ARRAY_KERNEL __attribute__((target_clones("avx512f", "avx2", "default")))
+#else
+#define RANGE_ARRAY_KERNEL
+#endif
+
+template <typename T> class RangeArray {
+	// Static
+	private:
+		// Properties
+		static const size_t BLOCK_SIZE = 256; // Ranges tested per block before checking for an early exit
+
+		// Functions | kernels
+		RANGE_ARRAY_KERNEL
+		static bool s_overlapsAny(const T* x0, const T* x1, size_t count, T queryX0, T queryX1) {
+			// Test whole blocks without branching, then exit early once a block has a hit
+			for (size_t blockStart = 0; blockStart < count; blockStart += BLOCK_SIZE) {
+				const size_t blockEnd = std::min(blockStart + BLOCK_SIZE, count);
+				unsigned char hit = 0;
+				for (size_t i = blockStart; i < blockEnd; i++)
+					hit |= static_cast<unsigned char>((x1[i] >= queryX0) & (x0[i] <= queryX1));
+				if (hit != 0)
+					return true;
+			}
+			return false;
+		}
+		RANGE_ARRAY_KERNEL
+		static void s_overlapMask(const T* x0, const T* x1, size_t count, T queryX0, T queryX1, unsigned char* mask) {
+			for (size_t i = 0; i < count; i++)
+				mask[i] = static_cast<unsigned char>((x1[i] >= queryX0) & (x0[i] <= queryX1));
+		}
+		RANGE_ARRAY_KERNEL
+		static size_t s_countOverlaps(const T* x0, const T* x1, size_t count, T queryX0, T queryX1) {
+			size_t overlapCount = 0;
+			for (size_t i = 0; i < count; i++)
+				overlapCount += static_cast<size_t>((x1[i] >= queryX0) & (x0[i] <= queryX1));
+			return overlapCount;
+		}
+
+	// Object
+	private:
+		// Properties
+		std::vector<T> x0s{};
+		std::vector<T> x1s{};
+
+	public:
+		// Constructor / Destructor
+		RangeArray() = default;
+		RangeArray(const std::vector<Range<T>>& ranges) {
+			reserve(ranges.size());
+			for (const Range<T>& range : ranges)
+				push(range);
+		}
+		RangeArray(const std::set<Range<T>>& ranges) {
+			reserve(ranges.size());
+			for (const Range<T>& range : ranges)
+				push(range);
+		}
+		RangeArray(const BinaryRangeTree<T>& binaryRangeTree) : RangeArray(binaryRangeTree.getRanges()) {
+
+		}
+		~RangeArray() = default;
+
+		// Getters
+		size_t size() const {
+			return x0s.size();
+		}
+		bool empty() const {
+			return x0s.empty();
+		}
+		Range<T> getRange(size_t index) const {
+			return Range<T>{ x0s[index], x1s[index] };
+		}
+		const std::vector<T>& getX0s() const {
+			return x0s;
+		}
+		const std::vector<T>& getX1s() const {
+			return x1s;
+		}
+
+		// Functions
+		void push(const Range<T>& range) {
+			x0s.push_back(range.getX0());
+			x1s.push_back(range.getX1());
+		}
+		void reserve(size_t capacity) {
+			x0s.reserve(capacity);
+			x1s.reserve(capacity);
+		}
+		void clear() {
+			x0s.clear();
+			x1s.clear();
+		}
+		void sort() {
+			std::vector<std::pair<T, T>> pairs(size());
+			for (size_t i = 0; i < pairs.size(); i++)
+				pairs[i] = { x0s[i], x1s[i] };
+
+			std::sort(pairs.begin(), pairs.end());
+
+			for (size_t i = 0; i < pairs.size(); i++) {
+				x0s[i] = pairs[i].first;
+				x1s[i] = pairs[i].second;
+			}
+		}
+		bool overlapsAny(const Range<T>& query) const {
+			return s_overlapsAny(x0s.data(), x1s.data(), size(), query.getX0(), query.getX1());
+		}
+		void overlapMask(const Range<T>& query, std::vector<unsigned char>* mask) const {
+			mask->resize(size());
+			s_overlapMask(x0s.data(), x1s.data(), size(), query.getX0(), query.getX1(), mask->data());
+		}
+		size_t countOverlaps(const Range<T>& query) const {
+			return s_countOverlaps(x0s.data(), x1s.data(), size(), query.getX0(), query.getX1());
+		}
+		RangeArray mergeSorted() const {
+			// Expects the ranges to be sorted by x0 (see sort()); overlapping and adjacent ranges merge, as in BinaryRangeTree
+			RangeArray merged{};
+			if (empty())
+				return merged;
+
+			T currentX0 = x0s[0];
+			T currentX1 = x1s[0];
+			for (size_t i = 1; i < size(); i++) {
+				if (currentX1 == std::numeric_limits<T>::max() || x0s[i] <= currentX1 + 1) {
+					currentX1 = x1s[i] > currentX1 ? x1s[i] : currentX1;
+				}
+				else {
+					merged.x0s.push_back(currentX0);
+					merged.x1s.push_back(currentX1);
+					currentX0 = x0s[i];
+					currentX1 = x1s[i];
+				}
+			}
+			merged.x0s.push_back(currentX0);
+			merged.x1s.push_back(currentX1);
+
+			return merged;
+		}
+		std::vector<Range<T>> toRanges() const {
+			std::vector<Range<T>> ranges{};
+			ranges.reserve(size());
+			for (size_t i = 0; i < size(); i++)
+				ranges.push_back(getRange(i));
+			return ranges;
+		}
+		BinaryRangeTree<T> toBinaryRangeTree() const {
+			// BinaryRangeTree rejects overlapping ranges, so coalesce them first
+			RangeArray sorted{ *this };
+			sorted.sort();
+			RangeArray merged = sorted.mergeSorted();
+
+			BinaryRangeTree<T> binaryRangeTree{};
+			for (size_t i = 0; i < merged.size(); i++)
+				binaryRangeTree.push(merged.getRange(i));
+			return binaryRangeTree;
+		}
+};
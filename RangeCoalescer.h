@@ -0,0 +1,117 @@
+/******************************************************************************
+ * Filename:    RangeCoalescer.h
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: This header defines the RangeCoalescer template class.
+ *              It is a streaming sweep line that accepts overlapping integral
+ *              ranges in any order within a bounded reorder window and emits
+ *              disjoint, coalesced ranges in ascending order. Memory is bounded
+ *              by the reorder window, not by the size of the input.
+ *              With spillToDisk, any order is accepted: full windows are spilled
+ *              to temporary files and merged at flush() (see RangeReorderWindow),
+ *              so output only becomes available after flush(). push() fails only
+ *              if a full window cannot be spilled.
+ *
+ * Usage:
+ *     RangeCoalescer<int> rangeCoalescer(1024);
+ *     rangeCoalescer.push({ 5, 10 });
+ *     rangeCoalescer.push({ 0, 6 });
+ *     rangeCoalescer.flush();
+ *     Range<int> range;
+ *     while (rangeCoalescer.pop(&range)) {} // [0, 10]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+#pragma once
+
+// Dependencies | std
+#include <deque>
+#include <vector>
+#include <limits>
+#include <cstddef>
+#include <type_traits>
+
+// Dependencies | utility
+#include "Range.h"
+#include "RangeReorderWindow.h"
+
+template <typename T> class RangeCoalescer {
+	// Static assert:
+	static_assert(std::is_integral<T>::value, "RangeCoalescer requires an integral type.");
+
+	// Object
+	private:
+		// Properties
+		RangeReorderWindow<T> reorderWindow;
+		std::deque<Range<T>> output{};
+		Range<T> active{};
+		bool hasActive{ false };
+
+		// Functions
+		void release(const Range<T>& range) {
+			if (!hasActive) {
+				active = range;
+				hasActive = true;
+			}
+			else if (active.getX1() == std::numeric_limits<T>::max() || range.getX0() <= active.getX1() + 1) {
+				if (range.getX1() > active.getX1())
+					active.setX1(range.getX1());
+			}
+			else {
+				output.push_back(active);
+				active = range;
+			}
+		}
+
+	public:
+		// Constructor / Destructor
+		RangeCoalescer() : RangeCoalescer(std::numeric_limits<size_t>::max()) {
+
+		}
+		RangeCoalescer(size_t reorderWindow, bool spillToDisk = false) : reorderWindow(reorderWindow, spillToDisk) {
+
+		}
+		~RangeCoalescer() = default;
+
+		// Getters
+		size_t getReorderWindow() const {
+			return reorderWindow.getReorderWindow();
+		}
+		size_t pendingCount() const {
+			return reorderWindow.pendingCount();
+		}
+
+		// Functions
+		bool push(const Range<T>& range) {
+			return reorderWindow.push(range, [this](const Range<T>& releasedRange) { release(releasedRange); });
+		}
+		size_t pushChunk(const std::vector<Range<T>>& ranges) {
+			size_t pushedCount = 0;
+			for (const Range<T>& range : ranges)
+				pushedCount += push(range) ? 1 : 0;
+			return pushedCount;
+		}
+		bool flush() {
+			// Ends the stream; call clear() before pushing a new one. Fails if spilled ranges were lost, in which case the output is incomplete
+			bool isFlushed = reorderWindow.flush([this](const Range<T>& releasedRange) { release(releasedRange); });
+			if (hasActive) {
+				output.push_back(active);
+				hasActive = false;
+			}
+			return isFlushed;
+		}
+		bool pop(Range<T>* range) {
+			if (output.empty())
+				return false;
+			if (range != nullptr)
+				*range = output.front();
+			output.pop_front();
+			return true;
+		}
+		void clear() {
+			reorderWindow.clear();
+			output.clear();
+			hasActive = false;
+		}
+};
@@ -0,0 +1,149 @@
+/******************************************************************************
+ * Filename:    RangeCoverage.h
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: This header defines the RangeCoverage template class.
+ *              It is a streaming sweep line that accepts overlapping integral
+ *              ranges in any order within a bounded reorder window and emits
+ *              ascending, disjoint segments together with how many input
+ *              ranges cover every point of the segment. Memory is bounded by
+ *              the reorder window plus the number of ranges open at the sweep
+ *              position, not by the size of the input.
+ *              With spillToDisk, any order is accepted: full windows are spilled
+ *              to temporary files and merged at flush() (see RangeReorderWindow),
+ *              so output only becomes available after flush(). push() fails only
+ *              if a full window cannot be spilled.
+ *
+ * Usage:
+ *     RangeCoverage<int> rangeCoverage(1024);
+ *     rangeCoverage.push({ 0, 10 });
+ *     rangeCoverage.push({ 5, 15 });
+ *     rangeCoverage.flush();
+ *     Range<int> range;
+ *     size_t depth;
+ *     while (rangeCoverage.pop(&range, &depth)) {} // [0, 4] 1, [5, 10] 2, [11, 15] 1
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+#pragma once
+
+// Dependencies | std
+#include <queue>
+#include <deque>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+
+// Dependencies | utility
+#include "Range.h"
+#include "RangeReorderWindow.h"
+
+template <typename T> class RangeCoverage {
+	// Static assert:
+	static_assert(std::is_integral<T>::value, "RangeCoverage requires an integral type.");
+
+	// Object
+	private:
+		// Properties
+		RangeReorderWindow<T> reorderWindow;
+		std::priority_queue<T, std::vector<T>, std::greater<T>> openX1s{}; // Min-heap on x1 of ranges covering the sweep position
+		std::deque<std::pair<Range<T>, size_t>> output{};
+		std::pair<Range<T>, size_t> segment{}; // Last segment, held back so equal-depth neighbours can be joined
+		bool hasSegment{ false };
+		T cursor{}; // First point not yet emitted
+
+		// Functions
+		void emit(T x0, T x1, size_t depth) {
+			if (hasSegment && segment.second == depth && segment.first.getX1() + 1 == x0) {
+				segment.first.setX1(x1);
+				return;
+			}
+			if (hasSegment)
+				output.push_back(segment);
+			segment = { Range<T>{ x0, x1 }, depth };
+			hasSegment = true;
+		}
+		void closeUntil(T x0) {
+			// Emit every segment that ends before x0
+			while (!openX1s.empty() && openX1s.top() < x0) {
+				T x1 = openX1s.top();
+				emit(cursor, x1, openX1s.size());
+				while (!openX1s.empty() && openX1s.top() == x1)
+					openX1s.pop();
+				cursor = x1 + 1;
+			}
+			if (!openX1s.empty() && cursor < x0)
+				emit(cursor, x0 - 1, openX1s.size());
+		}
+		void release(const Range<T>& range) {
+			closeUntil(range.getX0());
+			cursor = range.getX0();
+			openX1s.push(range.getX1());
+		}
+
+	public:
+		// Constructor / Destructor
+		RangeCoverage() : RangeCoverage(std::numeric_limits<size_t>::max()) {
+
+		}
+		RangeCoverage(size_t reorderWindow, bool spillToDisk = false) : reorderWindow(reorderWindow, spillToDisk) {
+
+		}
+		~RangeCoverage() = default;
+
+		// Getters
+		size_t getReorderWindow() const {
+			return reorderWindow.getReorderWindow();
+		}
+		size_t pendingCount() const {
+			return reorderWindow.pendingCount();
+		}
+
+		// Functions
+		bool push(const Range<T>& range) {
+			return reorderWindow.push(range, [this](const Range<T>& releasedRange) { release(releasedRange); });
+		}
+		size_t pushChunk(const std::vector<Range<T>>& ranges) {
+			size_t pushedCount = 0;
+			for (const Range<T>& range : ranges)
+				pushedCount += push(range) ? 1 : 0;
+			return pushedCount;
+		}
+		bool flush() {
+			// Ends the stream; call clear() before pushing a new one. Fails if spilled ranges were lost, in which case the output is incomplete
+			bool isFlushed = reorderWindow.flush([this](const Range<T>& releasedRange) { release(releasedRange); });
+			while (!openX1s.empty()) {
+				T x1 = openX1s.top();
+				emit(cursor, x1, openX1s.size());
+				while (!openX1s.empty() && openX1s.top() == x1)
+					openX1s.pop();
+				if (x1 != std::numeric_limits<T>::max())
+					cursor = x1 + 1;
+			}
+			if (hasSegment) {
+				output.push_back(segment);
+				hasSegment = false;
+			}
+			return isFlushed;
+		}
+		bool pop(Range<T>* range, size_t* depth) {
+			if (output.empty())
+				return false;
+			if (range != nullptr)
+				*range = output.front().first;
+			if (depth != nullptr)
+				*depth = output.front().second;
+			output.pop_front();
+			return true;
+		}
+		void clear() {
+			reorderWindow.clear();
+			openX1s = std::priority_queue<T, std::vector<T>, std::greater<T>>{};
+			output.clear();
+			hasSegment = false;
+		}
+};
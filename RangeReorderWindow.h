@@ -0,0 +1,287 @@
+/******************************************************************************
+ * Filename:    RangeReorderWindow.h
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: This header defines the RangeReorderWindow template class.
+ *              It is the front end shared by the streaming sweep lines
+ *              (RangeCoalescer, RangeCoverage): it buffers out of order
+ *              ranges and releases them in ascending x0 order.
+ *
+ *              By default at most reorderWindow ranges are buffered; a range
+ *              that starts before one that was already released is rejected.
+ *              With spillToDisk, a full window is instead written to a
+ *              temporary file as a sorted run and any order is accepted;
+ *              flush() then k-way merges the runs, so inputs larger than RAM
+ *              are released in order using one window plus one range per run.
+ *              Runs are merged MERGE_WIDTH at a time as they pile up, and all
+ *              of them once MAX_OPEN_RUNS are open, so open files stay below
+ *              MAX_OPEN_RUNS and each range is rewritten about
+ *              log8(input / window) times.
+ *
+ *              A run is kept only once it has been flushed to disk. If a
+ *              window cannot be spilled, push() rejects ranges while the
+ *              window is full and spilling is not retried until clear();
+ *              flush() returns false if a run cannot be read back in full.
+ *
+ * Usage:
+ *     RangeReorderWindow<int> reorderWindow(1024, true);
+ *     reorderWindow.push({ 5, 10 }, [](const Range<int>& range) {});
+ *     reorderWindow.flush([](const Range<int>& range) {});
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+#pragma once
+
+// Dependencies | std
+#include <queue>
+#include <vector>
+#include <utility>
+#include <limits>
+#include <cstdio>
+#include <cstddef>
+#include <type_traits>
+
+// Dependencies | utility
+#include "Range.h"
+
+template <typename T> class RangeReorderWindow {
+	// Static assert:
+	static_assert(std::is_integral<T>::value, "RangeReorderWindow requires an integral type.");
+
+	// Static
+	public:
+		// Properties
+		static const size_t MERGE_WIDTH = 8; // Runs of the same level merged into one run of the next level
+		static const size_t MAX_OPEN_RUNS = 32; // Open temporary files before every run is merged into one
+
+	private:
+		// Properties
+		static const size_t RUN_BUFFER_SIZE = 1 << 16; // stdio buffer per spilled run
+
+		// Types
+		struct Run {
+			std::FILE* file{ nullptr };
+			size_t count{}; // Ranges written, so a short read is told apart from the end of the run
+			size_t level{}; // 0 for a spilled window, one more than the highest merged run otherwise
+		};
+		struct GreaterX0 {
+			bool operator()(const Range<T>& a, const Range<T>& b) const {
+				return a.getX0() > b.getX0();
+			}
+			bool operator()(const std::pair<Range<T>, size_t>& a, const std::pair<Range<T>, size_t>& b) const {
+				return a.first.getX0() > b.first.getX0();
+			}
+		};
+
+		// Functions
+		static bool s_read(std::FILE* file, Range<T>* range) {
+			T x[2]{};
+			if (std::fread(x, sizeof(T), 2, file) != 2)
+				return false;
+			*range = Range<T>{ x[0], x[1] };
+			return true;
+		}
+		static bool s_write(std::FILE* file, const Range<T>& range) {
+			T x[2]{ range.getX0(), range.getX1() };
+			return std::fwrite(x, sizeof(T), 2, file) == 2;
+		}
+		static std::FILE* s_createRun() {
+			std::FILE* file = std::tmpfile();
+			if (file != nullptr)
+				std::setvbuf(file, nullptr, _IOFBF, RUN_BUFFER_SIZE);
+			return file;
+		}
+		static bool s_finishRun(std::FILE* file) {
+			// fwrite only fills the stdio buffer, so the run is on disk only once fflush succeeds
+			return std::fflush(file) == 0 && std::ferror(file) == 0;
+		}
+
+	// Object
+	private:
+		// Properties
+		size_t reorderWindow{};
+		bool spillToDisk{ false };
+		bool isSpillFailed{ false }; // A spill or merge failed; spilling stays off until clear()
+		std::priority_queue<Range<T>, std::vector<Range<T>>, GreaterX0> pending{}; // Min-heap on x0
+		std::vector<Run> runs{}; // Sorted runs spilled to temporary files, levels non-increasing
+		T watermark{}; // Greatest x0 released
+		bool hasWatermark{ false };
+
+		// Functions
+		bool spill() {
+			std::FILE* file = isSpillFailed ? nullptr : s_createRun();
+			if (file == nullptr) {
+				isSpillFailed = true;
+				return false;
+			}
+
+			std::vector<Range<T>> written{};
+			bool isWritten = true;
+			while (!pending.empty() && isWritten) {
+				isWritten = s_write(file, pending.top());
+				written.push_back(pending.top());
+				pending.pop();
+			}
+
+			if (!isWritten || !s_finishRun(file)) {
+				// Fail: put everything back and keep it in memory instead
+				for (const Range<T>& range : written)
+					pending.push(range);
+				std::fclose(file);
+				isSpillFailed = true;
+				return false;
+			}
+			runs.push_back(Run{ file, written.size(), 0 });
+
+			// The window is on disk either way; a failed merge only leaves more runs open
+			while (!isSpillFailed && runs.size() >= MERGE_WIDTH && runs[runs.size() - MERGE_WIDTH].level == runs.back().level)
+				isSpillFailed = !mergeRuns(runs.size() - MERGE_WIDTH);
+			if (!isSpillFailed && runs.size() >= MAX_OPEN_RUNS)
+				isSpillFailed = !mergeRuns(0);
+			return true;
+		}
+		template <typename Output>
+		bool merge(size_t firstRun, bool includePending, Output& output) {
+			// k-way merge of runs[firstRun..] (and what is still pending, as source runs.size()) into output
+			std::priority_queue<std::pair<Range<T>, size_t>, std::vector<std::pair<Range<T>, size_t>>, GreaterX0> heads{};
+			std::vector<size_t> readCounts(runs.size(), 0);
+			Range<T> range{};
+			for (size_t i = firstRun; i < runs.size(); i++) {
+				if (std::fseek(runs[i].file, 0, SEEK_SET) != 0 || !s_read(runs[i].file, &range))
+					return false; // Fail: run cannot be read back
+				heads.push({ range, i });
+				readCounts[i]++;
+			}
+			if (includePending && !pending.empty()) {
+				heads.push({ pending.top(), runs.size() });
+				pending.pop();
+			}
+
+			while (!heads.empty()) {
+				std::pair<Range<T>, size_t> head = heads.top();
+				heads.pop();
+				if (!output(head.first))
+					return false; // Fail: output cannot be written
+
+				if (head.second == runs.size()) {
+					if (!pending.empty()) {
+						heads.push({ pending.top(), runs.size() });
+						pending.pop();
+					}
+				}
+				else if (readCounts[head.second] < runs[head.second].count) {
+					if (!s_read(runs[head.second].file, &range))
+						return false; // Fail: run came back short
+					heads.push({ range, head.second });
+					readCounts[head.second]++;
+				}
+			}
+
+			return true;
+		}
+		bool mergeRuns(size_t firstRun) {
+			// Replaces runs[firstRun..] with a single run; on failure they are left as they were
+			std::FILE* file = s_createRun();
+			if (file == nullptr)
+				return false;
+
+			Run merged{ file, 0, 0 };
+			for (size_t i = firstRun; i < runs.size(); i++) {
+				merged.count += runs[i].count;
+				merged.level = runs[i].level + 1 > merged.level ? runs[i].level + 1 : merged.level;
+			}
+			auto write = [file](const Range<T>& range) { return s_write(file, range); };
+			if (!merge(firstRun, false, write) || !s_finishRun(file)) {
+				std::fclose(file);
+				return false;
+			}
+
+			closeRuns(firstRun);
+			runs.push_back(merged);
+			return true;
+		}
+		void closeRuns(size_t firstRun) {
+			for (size_t i = firstRun; i < runs.size(); i++)
+				std::fclose(runs[i].file);
+			runs.resize(firstRun);
+		}
+		template <typename Release>
+		void release(const Range<T>& range, Release& releaseFunction) {
+			watermark = range.getX0();
+			hasWatermark = true;
+			releaseFunction(range);
+		}
+
+	public:
+		// Constructor / Destructor
+		RangeReorderWindow(size_t reorderWindow, bool spillToDisk = false) : reorderWindow(reorderWindow), spillToDisk(spillToDisk) {
+
+		}
+		RangeReorderWindow(const RangeReorderWindow&) = delete;
+		RangeReorderWindow& operator=(const RangeReorderWindow&) = delete;
+		~RangeReorderWindow() {
+			closeRuns(0);
+		}
+
+		// Getters
+		size_t getReorderWindow() const {
+			return reorderWindow;
+		}
+		bool isSpillingToDisk() const {
+			return spillToDisk;
+		}
+		bool hasSpillFailed() const {
+			return isSpillFailed;
+		}
+		size_t pendingCount() const {
+			return pending.size();
+		}
+		size_t runCount() const {
+			return runs.size();
+		}
+
+		// Functions
+		template <typename Release>
+		bool push(const Range<T>& range, Release releaseFunction) {
+			if (spillToDisk) {
+				// Runs are merged at flush(), so any order is accepted while the window can be spilled
+				if (pending.size() >= reorderWindow && !spill())
+					return false; // Fail: window is full and cannot be spilled
+				pending.push(range);
+				return true;
+			}
+
+			// Fail: range starts before a range that already left the reorder window
+			if (hasWatermark && range.getX0() < watermark)
+				return false;
+
+			pending.push(range);
+			while (pending.size() > reorderWindow) {
+				release(pending.top(), releaseFunction);
+				pending.pop();
+			}
+
+			return true;
+		}
+		template <typename Release>
+		bool flush(Release releaseFunction) {
+			// Ends the stream; call clear() before pushing a new one. Fails if a spilled run cannot be read back in full
+			auto output = [this, &releaseFunction](const Range<T>& range) {
+				release(range, releaseFunction);
+				return true;
+			};
+			bool isRead = merge(0, true, output);
+
+			// A failed merge leaves ranges behind; they are dropped, as the released stream is incomplete anyway
+			pending = std::priority_queue<Range<T>, std::vector<Range<T>>, GreaterX0>{};
+			closeRuns(0);
+			return isRead;
+		}
+		void clear() {
+			pending = std::priority_queue<Range<T>, std::vector<Range<T>>, GreaterX0>{};
+			closeRuns(0);
+			isSpillFailed = false;
+			hasWatermark = false;
+		}
+};
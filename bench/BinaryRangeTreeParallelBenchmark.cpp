@@ -0,0 +1,107 @@
+/******************************************************************************
+ * Filename:    BinaryRangeTreeParallelBenchmark.cpp
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: Scaling benchmark for BinaryRangeTreeParallel. Runs coalesce,
+ *              unite, intersect and subtract (vector form) and fromValues /
+ *              intersect (BinaryRangeTree form) with 1 to N threads and prints
+ *              the time and speedup over one thread. Thread counts are set
+ *              with tbb::global_control, so TBB is required for anything
+ *              beyond the std::execution::seq baseline.
+ *
+ * Usage:
+ *     g++ -std=c++17 -O2 bench/BinaryRangeTreeParallelBenchmark.cpp -ltbb -o BinaryRangeTreeParallelBenchmark && ./BinaryRangeTreeParallelBenchmark [values] [maxThreads]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+// Dependencies | std
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include <thread>
+#include <functional>
+#include <execution>
+
+// Dependencies | TBB
+#if __has_include(<tbb/global_control.h>)
+#include <tbb/global_control.h>
+#define BENCHMARK_HAS_TBB 1
+#else
+#define BENCHMARK_HAS_TBB 0
+#endif
+
+// Dependencies | utility
+#include "../BinaryRangeTreeParallel.h"
+
+static volatile size_t s_sink = 0; // Keeps results alive so the calls are not optimized away
+
+template <typename Function>
+static double s_milliseconds(Function function) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	s_sink = s_sink + function();
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(int argc, char** argv) {
+	size_t valueCount = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 20000000;
+	size_t maxThreads = argc > 2 ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : std::thread::hardware_concurrency();
+	if (maxThreads == 0)
+		maxThreads = 1;
+
+	// Unsorted values over four times their count, so runs and gaps are both common
+	std::vector<long long> a(valueCount);
+	std::vector<long long> b(valueCount);
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	for (size_t i = 0; i < valueCount; i++) {
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		a[i] = static_cast<long long>((state >> 1) % (valueCount * 4));
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		b[i] = static_cast<long long>((state >> 1) % (valueCount * 4));
+	}
+	std::vector<Range<long long>> rangesA = BinaryRangeTreeParallel<long long>::coalesce(a.data(), a.size(), std::execution::par);
+	std::vector<Range<long long>> rangesB = BinaryRangeTreeParallel<long long>::coalesce(b.data(), b.size(), std::execution::par);
+	BinaryRangeTree<long long> treeA = BinaryRangeTreeParallel<long long>::fromValues(a.data(), a.size(), std::execution::par);
+	BinaryRangeTree<long long> treeB = BinaryRangeTreeParallel<long long>::fromValues(b.data(), b.size(), std::execution::par);
+
+	std::printf("%zu values, %zu / %zu ranges, %u hardware threads%s\n", valueCount, rangesA.size(), rangesB.size(), std::thread::hardware_concurrency(), BENCHMARK_HAS_TBB ? "" : " (no TBB: thread counts cannot be set)");
+	std::printf("%-8s %14s %14s %14s %14s %14s %14s\n", "threads", "coalesce", "unite", "intersect", "subtract", "fromValues", "intersect(tree)");
+
+	std::vector<std::function<size_t()>> benchmarks{
+		[&]() { return BinaryRangeTreeParallel<long long>::coalesce(a.data(), a.size(), std::execution::par).size(); },
+		[&]() { return BinaryRangeTreeParallel<long long>::unite(rangesA, rangesB, std::execution::par).size(); },
+		[&]() { return BinaryRangeTreeParallel<long long>::intersect(rangesA, rangesB, std::execution::par).size(); },
+		[&]() { return BinaryRangeTreeParallel<long long>::subtract(rangesA, rangesB, std::execution::par).size(); },
+		[&]() { return static_cast<size_t>(BinaryRangeTreeParallel<long long>::fromValues(a.data(), a.size(), std::execution::par).totalRange()); },
+		[&]() { return static_cast<size_t>(BinaryRangeTreeParallel<long long>::intersect(treeA, treeB, std::execution::par).totalRange()); }
+	};
+
+	// Warm up allocator and caches so the one-thread baseline is not penalized
+	for (std::function<size_t()>& benchmark : benchmarks)
+		s_milliseconds(benchmark);
+
+	std::vector<double> baseline{};
+	for (size_t threads = 1; threads <= maxThreads; threads++) {
+#if BENCHMARK_HAS_TBB
+		tbb::global_control control(tbb::global_control::max_allowed_parallelism, threads);
+#else
+		if (threads > 1)
+			break;
+#endif
+		std::vector<double> times{};
+		for (std::function<size_t()>& benchmark : benchmarks)
+			times.push_back(s_milliseconds(benchmark));
+		if (baseline.empty())
+			baseline = times;
+
+		std::printf("%-8zu", threads);
+		for (size_t i = 0; i < times.size(); i++)
+			std::printf(" %8.1fms %4.1fx", times[i], baseline[i] / times[i]);
+		std::printf("\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,82 @@
+/******************************************************************************
+ * Filename:    NumberBenchmark.cpp
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: Micro-benchmarks for every Number operator, the s_is*Safe
+ *              checks and the parse / format conversions. Each benchmark
+ *              runs over the same pseudo-random operands and prints the
+ *              average time per operation, so runs before and after a
+ *              change to Number.cpp can be compared directly. Correctness
+ *              is covered by fuzz/NumberFuzz.cpp.
+ *
+ * Usage:
+ *     g++ -std=c++17 -O2 bench/NumberBenchmark.cpp Number.cpp -o NumberBenchmark && ./NumberBenchmark [operations]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+// Dependencies | std
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <string>
+#include <vector>
+
+// Dependencies | utility
+#include "../Number.h"
+
+static volatile long long s_sink = 0LL; // Keeps results alive so the loops are not optimized away
+
+template <typename Function>
+static void s_benchmark(const char* name, size_t operationCount, Function function) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	long long checksum = function();
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	s_sink = s_sink + checksum;
+
+	double nanoseconds = std::chrono::duration<double, std::nano>(end - start).count();
+	std::printf("%-24s %10.2f ns/op\n", name, nanoseconds / static_cast<double>(operationCount));
+}
+
+int main(int argc, char** argv) {
+	size_t operationCount = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 10000000;
+
+	// Operands in [-10^6, 10^6] so the arithmetic stays in range and every operator takes its normal path
+	std::vector<Number> a(operationCount);
+	std::vector<Number> b(operationCount);
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	for (size_t i = 0; i < operationCount; i++) {
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		a[i] = static_cast<long long>((state >> 1) % 200000000000000ULL) - 100000000000000LL;
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		b[i] = static_cast<long long>((state >> 1) % 200000000000000ULL) - 100000000000000LL;
+		if (b[i].value == 0LL)
+			b[i] = 1LL;
+	}
+
+	s_benchmark("operator+", operationCount, [&]() { long long sum = 0LL; for (size_t i = 0; i < operationCount; i++) sum += (a[i] + b[i]).value; return sum; });
+	s_benchmark("operator-", operationCount, [&]() { long long sum = 0LL; for (size_t i = 0; i < operationCount; i++) sum += (a[i] - b[i]).value; return sum; });
+	s_benchmark("operator*", operationCount, [&]() { long long sum = 0LL; for (size_t i = 0; i < operationCount; i++) sum += (a[i] * b[i]).value; return sum; });
+	s_benchmark("operator/", operationCount, [&]() { long long sum = 0LL; for (size_t i = 0; i < operationCount; i++) sum += (a[i] / b[i]).value; return sum; });
+	s_benchmark("operator+=", operationCount, [&]() { Number sum{}; for (size_t i = 0; i < operationCount; i++) sum += a[i]; return sum.value; });
+	s_benchmark("operator-=", operationCount, [&]() { Number sum{}; for (size_t i = 0; i < operationCount; i++) sum -= a[i]; return sum.value; });
+	s_benchmark("operator*=", operationCount, [&]() { long long sum = 0LL; for (size_t i = 0; i < operationCount; i++) { Number x{ a[i].value }; x *= b[i]; sum += x.value; } return sum; });
+	s_benchmark("operator/=", operationCount, [&]() { long long sum = 0LL; for (size_t i = 0; i < operationCount; i++) { Number x{ a[i].value }; x /= b[i]; sum += x.value; } return sum; });
+	s_benchmark("operator< / ==", operationCount, [&]() { long long count = 0LL; for (size_t i = 0; i < operationCount; i++) count += (a[i] < b[i]) + (a[i] == b[i]); return count; });
+	s_benchmark("s_isAdditionSafe", operationCount, [&]() { long long count = 0LL; for (size_t i = 0; i < operationCount; i++) count += Number::s_isAdditionSafe(a[i], b[i]); return count; });
+	s_benchmark("s_isSubtractionSafe", operationCount, [&]() { long long count = 0LL; for (size_t i = 0; i < operationCount; i++) count += Number::s_isSubtractionSafe(a[i], b[i]); return count; });
+	s_benchmark("s_isMultiplicationSafe", operationCount, [&]() { long long count = 0LL; for (size_t i = 0; i < operationCount; i++) count += Number::s_isMultiplicationSafe(a[i], b[i]); return count; });
+	s_benchmark("s_isDivisionSafe", operationCount, [&]() { long long count = 0LL; for (size_t i = 0; i < operationCount; i++) count += Number::s_isDivisionSafe(a[i], b[i]); return count; });
+
+	// Conversions are far slower, so they run on a tenth of the operands
+	size_t conversionCount = operationCount / 10 == 0 ? 1 : operationCount / 10;
+	std::vector<std::string> strings(conversionCount);
+	for (size_t i = 0; i < conversionCount; i++)
+		strings[i] = a[i].to_string();
+	s_benchmark("to_string", conversionCount, [&]() { long long length = 0LL; for (size_t i = 0; i < conversionCount; i++) length += static_cast<long long>(a[i].to_string().size()); return length; });
+	s_benchmark("setValue(string)", conversionCount, [&]() { long long sum = 0LL; Number x{}; for (size_t i = 0; i < conversionCount; i++) { x.setValue(strings[i]); sum += x.value; } return sum; });
+	s_benchmark("operator double", conversionCount, [&]() { double sum = 0.0; for (size_t i = 0; i < conversionCount; i++) sum += static_cast<double>(a[i]); return static_cast<long long>(sum); });
+
+	return 0;
+}
@@ -0,0 +1,115 @@
+/******************************************************************************
+ * Filename:    RangeArrayBenchmark.cpp
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: Kernel benchmark for RangeArray. Times countOverlaps,
+ *              overlapMask and overlapsAny (with a query that misses, so the
+ *              whole array is scanned) against a scalar loop over
+ *              std::vector<Range<T>>, and prints ns per query and ranges per
+ *              ns. Build a second time with -DRANGE_ARRAY_NO_DISPATCH to
+ *              compare the dispatched kernels with the baseline x86-64 build.
+ *
+ * Usage:
+ *     g++ -std=c++17 -O2 bench/RangeArrayBenchmark.cpp -o RangeArrayBenchmark && ./RangeArrayBenchmark [ranges] [queries]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+// Dependencies | std
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <chrono>
+#include <vector>
+#include <functional>
+
+// Dependencies | utility
+#include "../RangeArray.h"
+
+// Scalar reference, kept scalar so the comparison shows what the kernels gain
+#if defined(__GNUC__) && !defined(__clang__)
+#define BENCHMARK_SCALAR __attribute__((noinline, optimize("no-tree-vectorize")))
+#else
+#define BENCHMARK_SCALAR __attribute__((noinline))
+#endif
+
+static volatile size_t s_sink = 0; // Keeps results alive so the calls are not optimized away
+
+BENCHMARK_SCALAR static size_t s_scalarCountOverlaps(const std::vector<Range<int>>& ranges, const Range<int>& query) {
+	size_t overlapCount = 0;
+	for (const Range<int>& range : ranges)
+		overlapCount += static_cast<size_t>((range.getX1() >= query.getX0()) & (range.getX0() <= query.getX1()));
+	return overlapCount;
+}
+BENCHMARK_SCALAR static void s_scalarOverlapMask(const std::vector<Range<int>>& ranges, const Range<int>& query, std::vector<unsigned char>* mask) {
+	mask->resize(ranges.size());
+	for (size_t i = 0; i < ranges.size(); i++)
+		(*mask)[i] = static_cast<unsigned char>((ranges[i].getX1() >= query.getX0()) & (ranges[i].getX0() <= query.getX1()));
+}
+BENCHMARK_SCALAR static bool s_scalarOverlapsAny(const std::vector<Range<int>>& ranges, const Range<int>& query) {
+	for (const Range<int>& range : ranges)
+		if (range.getX1() >= query.getX0() && range.getX0() <= query.getX1())
+			return true;
+	return false;
+}
+
+template <typename Function>
+static double s_nanosecondsPerQuery(size_t queryCount, Function function) {
+	std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < queryCount; i++)
+		s_sink = s_sink + function(i);
+	std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(queryCount);
+}
+
+int main(int argc, char** argv) {
+	size_t rangeCount = argc > 1 ? static_cast<size_t>(std::strtoull(argv[1], nullptr, 10)) : 1000000;
+	size_t queryCount = argc > 2 ? static_cast<size_t>(std::strtoull(argv[2], nullptr, 10)) : 200;
+
+	// Short ranges over [0, 1e9); queries land in [0, 1e9) or, for overlapsAny, past the end
+	std::vector<Range<int>> ranges{};
+	std::vector<Range<int>> queries{};
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	for (size_t i = 0; i < rangeCount + queryCount; i++) {
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		int x0 = static_cast<int>((state >> 33) % 1000000000ULL);
+		Range<int> range{ x0, x0 + static_cast<int>((state >> 20) % 1000ULL) };
+		if (i < rangeCount)
+			ranges.push_back(range);
+		else
+			queries.push_back(range);
+	}
+	RangeArray<int> rangeArray{ ranges };
+	const Range<int> miss{ 2000000000, 2000000001 };
+	std::vector<unsigned char> mask{};
+
+#ifdef RANGE_ARRAY_NO_DISPATCH
+	const char* build = " (RANGE_ARRAY_NO_DISPATCH)";
+#else
+	const char* build = "";
+#endif
+	std::printf("%zu ranges, %zu queries%s\n", rangeCount, queryCount, build);
+	std::printf("%-14s %14s %14s %10s\n", "kernel", "scalar ns", "RangeArray ns", "speedup");
+
+	struct Row {
+		const char* name;
+		std::function<size_t(size_t)> scalar;
+		std::function<size_t(size_t)> kernel;
+	};
+	std::vector<Row> rows{
+		{ "countOverlaps", [&](size_t i) { return s_scalarCountOverlaps(ranges, queries[i]); }, [&](size_t i) { return rangeArray.countOverlaps(queries[i]); } },
+		{ "overlapMask", [&](size_t i) { s_scalarOverlapMask(ranges, queries[i], &mask); return mask.size(); }, [&](size_t i) { rangeArray.overlapMask(queries[i], &mask); return mask.size(); } },
+		{ "overlapsAny", [&](size_t) { return static_cast<size_t>(s_scalarOverlapsAny(ranges, miss)); }, [&](size_t) { return static_cast<size_t>(rangeArray.overlapsAny(miss)); } }
+	};
+
+	for (Row& row : rows) {
+		// Warm up, then time
+		s_nanosecondsPerQuery(queryCount / 10 + 1, row.scalar);
+		s_nanosecondsPerQuery(queryCount / 10 + 1, row.kernel);
+		double scalar = s_nanosecondsPerQuery(queryCount, row.scalar);
+		double kernel = s_nanosecondsPerQuery(queryCount, row.kernel);
+		std::printf("%-14s %14.0f %14.0f %9.1fx\n", row.name, scalar, kernel, scalar / kernel);
+	}
+
+	return 0;
+}
@@ -0,0 +1,220 @@
+/******************************************************************************
+ * Filename:    NumberFuzz.cpp
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: Fuzz / property harness for Number. Every arithmetic operator,
+ *              its s_is*Safe check, the comparison operators and the
+ *              parse / format round-trip are checked against an __int128
+ *              reference model. Any mismatch aborts so the fuzzer records it.
+ *
+ * Usage:
+ *     libFuzzer:  clang++ -std=c++17 -O1 -g -fsanitize=fuzzer,address,undefined fuzz/NumberFuzz.cpp Number.cpp -o NumberFuzz && ./NumberFuzz
+ *     Standalone: g++ -std=c++17 -O1 -g -fsanitize=address,undefined -DNUMBER_FUZZ_STANDALONE fuzz/NumberFuzz.cpp Number.cpp -o NumberFuzz && ./NumberFuzz [iterations]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+// Dependencies | std
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+#include <string>
+#include <limits>
+
+// Dependencies | utility
+#include "../Number.h"
+
+typedef __int128 Int128;
+
+// Reference model
+static const long long SCALE = 100000000LL;
+static const Int128 LONG_LONG_MAX = std::numeric_limits<long long>::max();
+static const Int128 LONG_LONG_MIN = std::numeric_limits<long long>::min();
+
+static bool s_fits(Int128 value) {
+	return value >= LONG_LONG_MIN && value <= LONG_LONG_MAX;
+}
+static void s_check(bool condition, const char* what, long long a, long long b) {
+	if (!condition) {
+		std::fprintf(stderr, "Number mismatch: %s (a = %lld, b = %lld)\n", what, a, b);
+		std::abort();
+	}
+}
+static std::string s_referenceFormat(long long value) {
+	// Digits of the magnitude, at least MAX_DECIMAL_DIGIT_COUNT + 1 of them
+	Int128 magnitude = value < 0LL ? -static_cast<Int128>(value) : static_cast<Int128>(value);
+	std::string digits{};
+	do {
+		digits.insert(digits.begin(), static_cast<char>('0' + static_cast<int>(magnitude % 10)));
+		magnitude /= 10;
+	} while (magnitude != 0);
+	while (digits.size() < 9)
+		digits.insert(digits.begin(), '0');
+	return (value < 0LL ? "-" : "") + digits.substr(0, digits.size() - 8) + "." + digits.substr(digits.size() - 8);
+}
+static bool s_referenceParse(const std::string& string, long long* value) {
+	// Accepts the same grammar as Number::setValue: [-]digits[.digits], at most 10 whole and 8 decimal digits
+	size_t i = 0;
+	bool isNegative = !string.empty() && string[0] == '-';
+	if (isNegative)
+		i++;
+
+	Int128 whole = 0;
+	Int128 decimal = 0;
+	int wholeDigitCount = 0;
+	int decimalDigitCount = 0;
+	bool decimalPointPresent = false;
+	for (; i < string.size(); i++) {
+		char c = string[i];
+		if (c >= '0' && c <= '9') {
+			if (decimalPointPresent) {
+				decimal = decimal * 10 + (c - '0');
+				decimalDigitCount++;
+			}
+			else {
+				whole = whole * 10 + (c - '0');
+				wholeDigitCount++;
+			}
+		}
+		else if (c == '.' && !decimalPointPresent) {
+			decimalPointPresent = true;
+		}
+		else {
+			return false;
+		}
+		if (wholeDigitCount > 10 || decimalDigitCount > 8)
+			return false;
+	}
+
+	for (; decimalDigitCount < 8; decimalDigitCount++)
+		decimal *= 10;
+	Int128 result = whole * SCALE + decimal;
+	*value = static_cast<long long>(isNegative ? -result : result);
+	return true;
+}
+
+// Properties
+static void s_checkArithmetic(long long a, long long b) {
+	Number x{ a };
+	Number y{ b };
+
+	// Addition / subtraction: exact, 0 on overflow
+	Int128 sum = static_cast<Int128>(a) + b;
+	s_check(Number::s_isAdditionSafe(x, y) == s_fits(sum), "s_isAdditionSafe", a, b);
+	s_check((x + y).value == (s_fits(sum) ? static_cast<long long>(sum) : 0LL), "operator+", a, b);
+	Int128 difference = static_cast<Int128>(a) - b;
+	s_check(Number::s_isSubtractionSafe(x, y) == s_fits(difference), "s_isSubtractionSafe", a, b);
+	s_check((x - y).value == (s_fits(difference) ? static_cast<long long>(difference) : 0LL), "operator-", a, b);
+
+	// Multiplication: a * b / 10^8 truncated towards zero, 0 on overflow
+	Int128 product = static_cast<Int128>(a) * b / SCALE;
+	s_check(Number::s_isMultiplicationSafe(x, y) == s_fits(product), "s_isMultiplicationSafe", a, b);
+	s_check((x * y).value == (s_fits(product) ? static_cast<long long>(product) : 0LL), "operator*", a, b);
+
+	// Division: a * 10^8 / b truncated towards zero, 0 on overflow or division by zero
+	if (b == 0LL) {
+		s_check(!Number::s_isDivisionSafe(x, y), "s_isDivisionSafe", a, b);
+		s_check((x / y).value == 0LL, "operator/", a, b);
+	}
+	else {
+		Int128 quotient = static_cast<Int128>(a) * SCALE / b;
+		s_check(Number::s_isDivisionSafe(x, y) == s_fits(quotient), "s_isDivisionSafe", a, b);
+		s_check((x / y).value == (s_fits(quotient) ? static_cast<long long>(quotient) : 0LL), "operator/", a, b);
+	}
+
+	// Compound assignment matches the binary operators
+	Number z{ a };
+	s_check((z += y).value == (x + y).value, "operator+=", a, b);
+	z = a;
+	s_check((z -= y).value == (x - y).value, "operator-=", a, b);
+	z = a;
+	s_check((z *= y).value == (x * y).value, "operator*=", a, b);
+	z = a;
+	s_check((z /= y).value == (x / y).value, "operator/=", a, b);
+
+	// Comparisons
+	s_check((x == y) == (a == b) && (x != y) == (a != b), "operator== / !=", a, b);
+	s_check((x < y) == (a < b) && (x > y) == (a > b), "operator< / >", a, b);
+	s_check((x <= y) == (a <= b) && (x >= y) == (a >= b), "operator<= / >=", a, b);
+}
+static void s_checkFormat(long long a) {
+	// to_string matches the reference, and parses back whenever it is within setValue's digit limits
+	std::string string = Number{ a }.to_string();
+	s_check(string == s_referenceFormat(a), "to_string", a, 0LL);
+
+	long long expected = 0LL;
+	Number parsed{ 12345LL };
+	bool isParsed = parsed.setValue(string);
+	s_check(isParsed == s_referenceParse(string, &expected), "setValue(to_string()) accepted", a, 0LL);
+	if (isParsed)
+		s_check(parsed.value == a, "setValue(to_string()) round-trip", a, 0LL);
+}
+static void s_checkParse(const std::string& string) {
+	// Arbitrary input: setValue must agree with the reference grammar and leave the value untouched on failure
+	long long expected = 0LL;
+	Number parsed{ 12345LL };
+	bool isAccepted = s_referenceParse(string, &expected);
+	s_check(parsed.setValue(string) == isAccepted, "setValue accepted", 0LL, 0LL);
+	s_check(parsed.value == (isAccepted ? expected : 12345LL), "setValue value", expected, parsed.value);
+	if (isAccepted)
+		s_check(Number{ parsed.to_string() }.value == parsed.value, "to_string(setValue()) round-trip", parsed.value, 0LL);
+}
+
+// Entry point | libFuzzer
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	// The first 16 bytes are two operands; the whole input is also parsed as a string
+	long long operands[2] = { 0LL, 0LL };
+	std::memcpy(operands, data, size < sizeof(operands) ? size : sizeof(operands));
+
+	s_checkArithmetic(operands[0], operands[1]);
+	s_checkArithmetic(operands[1], operands[0]);
+	s_checkFormat(operands[0]);
+	s_checkFormat(operands[1]);
+	s_checkParse(std::string(reinterpret_cast<const char*>(data), size));
+
+	return 0;
+}
+
+// Entry point | standalone
+#ifdef NUMBER_FUZZ_STANDALONE
+static uint64_t s_random(uint64_t* state) {
+	// xorshift64*
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 2685821657736338717ULL;
+}
+static long long s_randomOperand(uint64_t* state) {
+	// Mix full-width values, values near the scale and edge cases so every overflow boundary is reached
+	static const long long edges[] = { 0LL, 1LL, -1LL, SCALE, -SCALE, SCALE - 1LL, -SCALE + 1LL, std::numeric_limits<long long>::max(), std::numeric_limits<long long>::min(), std::numeric_limits<long long>::max() - 1LL, std::numeric_limits<long long>::min() + 1LL, 3037000499LL, -3037000499LL, 96038388349LL, -96038388349LL };
+	uint64_t random = s_random(state);
+	switch (random % 5ULL) {
+		case 0ULL: return static_cast<long long>(s_random(state));
+		case 1ULL: return static_cast<long long>(s_random(state) % 2000000000000000000ULL) - 1000000000000000000LL;
+		case 2ULL: return static_cast<long long>(s_random(state) % 20000000000ULL) - 10000000000LL;
+		case 3ULL: return static_cast<long long>(s_random(state) % 20000ULL) - 10000LL;
+		default: return edges[s_random(state) % (sizeof(edges) / sizeof(edges[0]))];
+	}
+}
+int main(int argc, char** argv) {
+	unsigned long long iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000ULL;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+	static const char alphabet[] = "0123456789.-x";
+
+	for (unsigned long long i = 0; i < iterations; i++) {
+		long long operands[2] = { s_randomOperand(&state), s_randomOperand(&state) };
+		LLVMFuzzerTestOneInput(reinterpret_cast<const uint8_t*>(operands), sizeof(operands));
+
+		// Random strings over the characters setValue cares about
+		std::string string(static_cast<size_t>(s_random(&state) % 24ULL), '0');
+		for (char& c : string)
+			c = alphabet[s_random(&state) % (sizeof(alphabet) - 1)];
+		s_checkParse(string);
+	}
+
+	std::printf("NumberFuzz: %llu iterations passed\n", iterations);
+	return 0;
+}
+#endif
@@ -0,0 +1,227 @@
+/******************************************************************************
+ * Filename:    RangeAllocatorFuzz.cpp
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: Fuzz / property harness for RangeAllocator and the
+ *              BinaryRangeTree it converts to and from. Random push / pop /
+ *              popLeast / allocateContiguous sequences are checked against a
+ *              bitset model after every step: contents, canonical form
+ *              (disjoint, non-adjacent ranges), the exact range picked by
+ *              every allocation strategy and the values popLeast returns.
+ *              Any mismatch aborts so the fuzzer records it.
+ *
+ * Usage:
+ *     libFuzzer:  clang++ -std=c++17 -O1 -g -fsanitize=fuzzer,address,undefined fuzz/RangeAllocatorFuzz.cpp -o RangeAllocatorFuzz && ./RangeAllocatorFuzz
+ *     Standalone: g++ -std=c++17 -O1 -g -fsanitize=address,undefined -DRANGE_ALLOCATOR_FUZZ_STANDALONE fuzz/RangeAllocatorFuzz.cpp -o RangeAllocatorFuzz && ./RangeAllocatorFuzz [iterations]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+// Dependencies | std
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <bitset>
+#include <limits>
+#include <vector>
+
+// Dependencies | utility
+#include "../RangeAllocator.h"
+
+static const int MODEL_SIZE = 512;
+typedef std::bitset<MODEL_SIZE> Model;
+
+// Reference model
+static void s_check(bool condition, const char* what) {
+	if (!condition) {
+		std::fprintf(stderr, "RangeAllocator mismatch: %s\n", what);
+		std::abort();
+	}
+}
+static std::vector<Range<int>> s_modelRanges(const Model& model) {
+	std::vector<Range<int>> ranges{};
+	for (int x = 0; x < MODEL_SIZE; x++) {
+		if (!model[x])
+			continue;
+		int x1 = x;
+		while (x1 + 1 < MODEL_SIZE && model[x1 + 1])
+			x1++;
+		ranges.push_back(Range<int>{ x, x1 });
+		x = x1;
+	}
+	return ranges;
+}
+static void s_checkRanges(const std::set<Range<int>>& ranges, const Model& model, const char* what) {
+	// Maximal runs of the model are exactly the canonical form
+	std::vector<Range<int>> expected = s_modelRanges(model);
+	s_check(ranges.size() == expected.size(), what);
+	size_t i = 0;
+	for (const Range<int>& range : ranges) {
+		s_check(range.getX0() == expected[i].getX0() && range.getX1() == expected[i].getX1(), what);
+		i++;
+	}
+}
+static int s_expectedX0(const Model& model, RangeAllocationStrategy strategy, int count, int hint) {
+	// Brute-force choice of each strategy, -1 if nothing fits
+	int bestX0 = -1;
+	int bestScore = std::numeric_limits<int>::max();
+	for (const Range<int>& range : s_modelRanges(model)) {
+		int length = range.getX1() - range.getX0() + 1;
+		if (length < count)
+			continue;
+		int x0 = range.getX0();
+		int score = 0;
+		if (strategy == RangeAllocationStrategy::BEST_FIT) {
+			score = length;
+		}
+		else if (strategy == RangeAllocationStrategy::NEAR_HINT) {
+			int lastX0 = range.getX1() - count + 1;
+			x0 = hint < x0 ? x0 : (hint < lastX0 ? hint : lastX0);
+			score = x0 < hint ? hint - x0 : x0 - hint;
+		}
+		if (score < bestScore) {
+			bestScore = score;
+			bestX0 = x0;
+		}
+	}
+	return bestX0;
+}
+
+// Properties
+static void s_run(const uint8_t* data, size_t size) {
+	// Every 3 bytes are one operation: kind, and two operands
+	RangeAllocator<int> rangeAllocator{};
+	BinaryRangeTree<int> binaryRangeTree{};
+	Model model{};
+	for (size_t i = 0; i + 3 <= size; i += 3) {
+		int a = data[i + 1] | ((data[i] & 0x01) << 8);
+		int b = data[i + 2];
+		switch ((data[i] >> 1) % 5) {
+			case 0: {
+				// Free a range; fails if any of it is already free
+				int x1 = a + b % 16 < MODEL_SIZE ? a + b % 16 : MODEL_SIZE - 1;
+				bool isFree = false;
+				for (int x = a; x <= x1; x++)
+					isFree = isFree || model[x];
+				s_check(rangeAllocator.push(Range<int>{ a, x1 }) == !isFree, "push");
+				if (!isFree)
+					for (int x = a; x <= x1; x++)
+						model[x] = true;
+				break;
+			}
+			case 1: {
+				RangeAllocationStrategy strategy = static_cast<RangeAllocationStrategy>(b % 3);
+				int count = 1 + b / 3 % 24;
+				int expectedX0 = s_expectedX0(model, strategy, count, a);
+				int x0 = -1;
+				bool isAllocated = rangeAllocator.allocateContiguous(static_cast<unsigned>(count), strategy, &x0, a);
+				s_check(isAllocated == (expectedX0 >= 0), "allocateContiguous result");
+				if (!isAllocated)
+					break;
+				if (strategy == RangeAllocationStrategy::BEST_FIT) {
+					// Any shortest fitting range will do
+					int length = 0;
+					while (x0 + length < MODEL_SIZE && model[x0 + length])
+						length++;
+					s_check(x0 == 0 || !model[x0 - 1], "BEST_FIT range start");
+					int bestLength = std::numeric_limits<int>::max();
+					for (const Range<int>& range : s_modelRanges(model))
+						if (range.getX1() - range.getX0() + 1 >= count && range.getX1() - range.getX0() + 1 < bestLength)
+							bestLength = range.getX1() - range.getX0() + 1;
+					s_check(length == bestLength, "BEST_FIT length");
+				}
+				else {
+					s_check(x0 == expectedX0, strategy == RangeAllocationStrategy::FIRST_FIT ? "FIRST_FIT" : "NEAR_HINT");
+				}
+				for (int x = x0; x < x0 + count; x++) {
+					s_check(model[x], "allocated value was free");
+					model[x] = false;
+				}
+				break;
+			}
+			case 2: {
+				// The least values, in order
+				unsigned count = static_cast<unsigned>(b % 40);
+				std::vector<Range<int>> poppedRanges{};
+				unsigned poppedCount = rangeAllocator.popLeast(count, &poppedRanges);
+				unsigned expectedCount = count < model.count() ? count : static_cast<unsigned>(model.count());
+				s_check(poppedCount == expectedCount, "popLeast count");
+				unsigned checkedCount = 0;
+				for (const Range<int>& range : poppedRanges) {
+					for (int x = range.getX0(); x <= range.getX1(); x++) {
+						s_check(model._Find_first() == static_cast<size_t>(x), "popLeast least values");
+						model[x] = false;
+						checkedCount++;
+					}
+				}
+				s_check(checkedCount == poppedCount, "popLeast ranges");
+				break;
+			}
+			case 3: {
+				// BinaryRangeTree::pop removes the part of the range inside the first stored range it overlaps
+				int x1 = a + b % 8 < MODEL_SIZE ? a + b % 8 : MODEL_SIZE - 1;
+				int overlapX0 = a;
+				while (overlapX0 <= x1 && !model[overlapX0])
+					overlapX0++;
+				binaryRangeTree = rangeAllocator.toBinaryRangeTree();
+				s_check(binaryRangeTree.pop(Range<int>{ a, x1 }) == (overlapX0 <= x1), "BinaryRangeTree::pop");
+				for (int x = overlapX0; x <= x1 && model[x]; x++)
+					model[x] = false;
+				s_checkRanges(binaryRangeTree.getRanges(), model, "BinaryRangeTree::pop contents");
+				rangeAllocator = RangeAllocator<int>{ binaryRangeTree };
+				break;
+			}
+			default: {
+				// Round trip through BinaryRangeTree
+				rangeAllocator = RangeAllocator<int>{ rangeAllocator.toBinaryRangeTree() };
+				break;
+			}
+		}
+
+		s_checkRanges(rangeAllocator.getRanges(), model, "contents");
+		s_check(rangeAllocator.size() == s_modelRanges(model).size() && rangeAllocator.empty() == model.none(), "size");
+	}
+}
+
+// Entry point | libFuzzer
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	s_run(data, size);
+	return 0;
+}
+
+// Entry point | standalone
+#ifdef RANGE_ALLOCATOR_FUZZ_STANDALONE
+static uint64_t s_random(uint64_t* state) {
+	// xorshift64*
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 2685821657736338717ULL;
+}
+int main(int argc, char** argv) {
+	unsigned long long iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000ULL;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	for (unsigned long long i = 0; i < iterations; i++) {
+		std::vector<uint8_t> data(static_cast<size_t>(s_random(&state) % 1200ULL));
+		for (uint8_t& byte : data)
+			byte = static_cast<uint8_t>(s_random(&state));
+		LLVMFuzzerTestOneInput(data.data(), data.size());
+	}
+
+	// Full domain: lengths beyond the signed range, and both ends of it
+	const int minimum = std::numeric_limits<int>::min();
+	const int maximum = std::numeric_limits<int>::max();
+	RangeAllocator<int> rangeAllocator{ BinaryRangeTree<int>{ minimum, maximum } };
+	int x0 = 0;
+	s_check(rangeAllocator.allocateContiguous(4000000000U, RangeAllocationStrategy::NEAR_HINT, &x0, 5), "full domain NEAR_HINT");
+	s_check(x0 == maximum - 3999999999LL, "full domain NEAR_HINT start");
+	s_check(rangeAllocator.allocateContiguous(294967296U, RangeAllocationStrategy::FIRST_FIT, &x0) && x0 == minimum && rangeAllocator.empty(), "full domain FIRST_FIT");
+	s_check(rangeAllocator.push(maximum) && rangeAllocator.push(minimum) && rangeAllocator.size() == 2, "full domain push");
+	s_check(rangeAllocator.popLeast(4U, nullptr) == 2U && rangeAllocator.empty(), "full domain popLeast");
+
+	std::printf("RangeAllocatorFuzz: %llu iterations passed\n", iterations);
+	return 0;
+}
+#endif
@@ -0,0 +1,224 @@
+/******************************************************************************
+ * Filename:    RangeSweepFuzz.cpp
+ * Author:      Chris Barrios Agosto
+ * Date:        October 19, 2026
+ * Description: Fuzz / property harness for the streaming sweep lines
+ *              (RangeReorderWindow, RangeCoalescer, RangeCoverage), in memory
+ *              and spilling to disk. Output is checked against a reference
+ *              sweep over every accepted range. The standalone build also
+ *              runs the spill path through multi-level run merges and the
+ *              open-run cap, and, on POSIX, with RLIMIT_FSIZE / RLIMIT_NOFILE
+ *              set so spills fail: no accepted range may be lost and the
+ *              window may not grow. Any mismatch aborts so the fuzzer
+ *              records it.
+ *
+ * Usage:
+ *     libFuzzer:  clang++ -std=c++17 -O1 -g -fsanitize=fuzzer,address,undefined fuzz/RangeSweepFuzz.cpp -o RangeSweepFuzz && ./RangeSweepFuzz
+ *     Standalone: g++ -std=c++17 -O1 -g -fsanitize=address,undefined -DRANGE_SWEEP_FUZZ_STANDALONE fuzz/RangeSweepFuzz.cpp -o RangeSweepFuzz && ./RangeSweepFuzz [iterations]
+ *
+ * License:     MIT License
+ ******************************************************************************/
+
+// Dependencies | std
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdio>
+#include <map>
+#include <vector>
+#include <utility>
+#include <algorithm>
+
+// Dependencies | utility
+#include "../RangeReorderWindow.h"
+#include "../RangeCoalescer.h"
+#include "../RangeCoverage.h"
+
+typedef std::pair<Range<int>, size_t> Segment;
+
+// Reference model
+static void s_check(bool condition, const char* what) {
+	if (!condition) {
+		std::fprintf(stderr, "Sweep mismatch: %s\n", what);
+		std::abort();
+	}
+}
+static std::vector<Segment> s_referenceCoverage(const std::vector<Range<int>>& ranges) {
+	// Depth changes at x0 and x1 + 1; equal-depth neighbours are joined, as RangeCoverage does
+	std::map<long long, long long> deltas{};
+	for (const Range<int>& range : ranges) {
+		deltas[range.getX0()]++;
+		deltas[static_cast<long long>(range.getX1()) + 1]--;
+	}
+
+	std::vector<Segment> segments{};
+	long long depth = 0;
+	for (std::map<long long, long long>::iterator iterator = deltas.begin(); iterator != deltas.end(); iterator++) {
+		depth += iterator->second;
+		std::map<long long, long long>::iterator next = std::next(iterator);
+		if (depth == 0 || next == deltas.end())
+			continue;
+		int x0 = static_cast<int>(iterator->first);
+		int x1 = static_cast<int>(next->first - 1);
+		if (!segments.empty() && segments.back().second == static_cast<size_t>(depth) && segments.back().first.getX1() + 1LL == x0)
+			segments.back().first.setX1(x1);
+		else
+			segments.push_back({ Range<int>{ x0, x1 }, static_cast<size_t>(depth) });
+	}
+	return segments;
+}
+static std::vector<Range<int>> s_referenceCoalesce(const std::vector<Range<int>>& ranges) {
+	std::vector<Range<int>> coalesced{};
+	for (const Segment& segment : s_referenceCoverage(ranges)) {
+		if (!coalesced.empty() && coalesced.back().getX1() + 1LL == segment.first.getX0())
+			coalesced.back().setX1(segment.first.getX1());
+		else
+			coalesced.push_back(segment.first);
+	}
+	return coalesced;
+}
+
+// Properties
+static void s_checkSweeps(const std::vector<Range<int>>& ranges, size_t reorderWindow, bool spillToDisk) {
+	// Only accepted ranges are in the reference; with spillToDisk every range must be accepted unless spilling failed
+	RangeCoalescer<int> rangeCoalescer(reorderWindow, spillToDisk);
+	RangeCoverage<int> rangeCoverage(reorderWindow, spillToDisk);
+	std::vector<Range<int>> accepted{};
+	for (const Range<int>& range : ranges) {
+		bool isCoalesced = rangeCoalescer.push(range);
+		bool isCovered = rangeCoverage.push(range);
+		s_check(isCoalesced == isCovered, "push accepted");
+		if (isCoalesced)
+			accepted.push_back(range);
+	}
+	s_check(rangeCoalescer.flush() && rangeCoverage.flush(), "flush");
+
+	std::vector<Range<int>> coalesced{};
+	Range<int> range{};
+	while (rangeCoalescer.pop(&range))
+		coalesced.push_back(range);
+	std::vector<Range<int>> expectedCoalesced = s_referenceCoalesce(accepted);
+	s_check(coalesced.size() == expectedCoalesced.size(), "RangeCoalescer size");
+	for (size_t i = 0; i < coalesced.size(); i++)
+		s_check(coalesced[i].getX0() == expectedCoalesced[i].getX0() && coalesced[i].getX1() == expectedCoalesced[i].getX1(), "RangeCoalescer range");
+
+	std::vector<Segment> covered{};
+	size_t depth = 0;
+	while (rangeCoverage.pop(&range, &depth))
+		covered.push_back({ range, depth });
+	std::vector<Segment> expectedCovered = s_referenceCoverage(accepted);
+	s_check(covered.size() == expectedCovered.size(), "RangeCoverage size");
+	for (size_t i = 0; i < covered.size(); i++)
+		s_check(covered[i].first.getX0() == expectedCovered[i].first.getX0() && covered[i].first.getX1() == expectedCovered[i].first.getX1() && covered[i].second == expectedCovered[i].second, "RangeCoverage segment");
+}
+static void s_checkReorderWindow(const std::vector<Range<int>>& ranges, size_t windowSize, bool expectSpillFailure) {
+	// Spilling: released ranges are every accepted range in x0 order, the window never outgrows itself and open runs stay capped
+	RangeReorderWindow<int> reorderWindow(windowSize, true);
+	std::vector<Range<int>> accepted{};
+	std::vector<Range<int>> released{};
+	auto releaseFunction = [&released](const Range<int>& range) { released.push_back(range); };
+	for (const Range<int>& range : ranges) {
+		if (reorderWindow.push(range, releaseFunction))
+			accepted.push_back(range);
+		s_check(reorderWindow.pendingCount() <= reorderWindow.getReorderWindow(), "pendingCount bounded by the window");
+		s_check(reorderWindow.runCount() < RangeReorderWindow<int>::MAX_OPEN_RUNS, "runCount bounded");
+	}
+	s_check(reorderWindow.hasSpillFailed() == expectSpillFailure, "hasSpillFailed");
+	s_check(accepted.size() == ranges.size() || expectSpillFailure, "push accepted");
+	s_check(reorderWindow.flush(releaseFunction), "flush");
+	s_check(reorderWindow.runCount() == 0 && reorderWindow.pendingCount() == 0, "flush drains");
+
+	std::vector<int> acceptedX0s{};
+	std::vector<int> releasedX0s{};
+	for (const Range<int>& range : accepted)
+		acceptedX0s.push_back(range.getX0());
+	for (const Range<int>& range : released)
+		releasedX0s.push_back(range.getX0());
+	s_check(std::is_sorted(releasedX0s.begin(), releasedX0s.end()), "released in x0 order");
+	std::sort(acceptedX0s.begin(), acceptedX0s.end());
+	s_check(acceptedX0s == releasedX0s, "released every accepted range");
+}
+
+// Entry point | libFuzzer
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+	// Byte 0 is the reorder window; every following 3 bytes are a 16 bit x0 and a length up to 255
+	if (size == 0)
+		return 0;
+	size_t reorderWindow = 1 + data[0] % 16;
+	std::vector<Range<int>> ranges{};
+	for (size_t i = 1; i + 3 <= size; i += 3) {
+		int x0 = static_cast<int16_t>(static_cast<uint16_t>(data[i] | (data[i + 1] << 8)));
+		ranges.push_back(Range<int>{ x0, x0 + data[i + 2] });
+	}
+
+	s_checkSweeps(ranges, reorderWindow, false);
+	s_checkSweeps(ranges, reorderWindow, true);
+	s_checkReorderWindow(ranges, reorderWindow, false);
+
+	return 0;
+}
+
+// Entry point | standalone
+#ifdef RANGE_SWEEP_FUZZ_STANDALONE
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <sys/resource.h>
+#define RANGE_SWEEP_FUZZ_HAS_RLIMIT 1
+#else
+#define RANGE_SWEEP_FUZZ_HAS_RLIMIT 0
+#endif
+
+static uint64_t s_random(uint64_t* state) {
+	// xorshift64*
+	*state ^= *state >> 12;
+	*state ^= *state << 25;
+	*state ^= *state >> 27;
+	return *state * 2685821657736338717ULL;
+}
+static std::vector<Range<int>> s_randomRanges(uint64_t* state, size_t count, int span) {
+	std::vector<Range<int>> ranges{};
+	for (size_t i = 0; i < count; i++) {
+		int x0 = static_cast<int>(s_random(state) % static_cast<uint64_t>(span)) - span / 2;
+		ranges.push_back(Range<int>{ x0, x0 + static_cast<int>(s_random(state) % 32ULL) });
+	}
+	return ranges;
+}
+int main(int argc, char** argv) {
+	unsigned long long iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000ULL;
+	uint64_t state = 0x9E3779B97F4A7C15ULL;
+
+	// Random inputs through the libFuzzer entry point
+	for (unsigned long long i = 0; i < iterations; i++) {
+		std::vector<uint8_t> data(static_cast<size_t>(s_random(&state) % 600ULL));
+		for (uint8_t& byte : data)
+			byte = static_cast<uint8_t>(s_random(&state));
+		LLVMFuzzerTestOneInput(data.data(), data.size());
+	}
+
+	// One range per run: 40000 runs go through every merge level and past MAX_OPEN_RUNS
+	s_checkReorderWindow(s_randomRanges(&state, 40000, 1000000), 1, false);
+	s_checkSweeps(s_randomRanges(&state, 40000, 100000), 3, true);
+
+#if RANGE_SWEEP_FUZZ_HAS_RLIMIT
+	// Spills that cannot reach the disk: the window stays bounded and nothing accepted is lost
+	std::signal(SIGXFSZ, SIG_IGN);
+	rlimit limit{};
+	getrlimit(RLIMIT_FSIZE, &limit);
+	rlimit fileSizeLimit{ 14000, limit.rlim_max };
+	if (setrlimit(RLIMIT_FSIZE, &fileSizeLimit) == 0) {
+		s_checkReorderWindow(s_randomRanges(&state, 20000, 1000000), 1000, true);
+		setrlimit(RLIMIT_FSIZE, &limit);
+	}
+
+	getrlimit(RLIMIT_NOFILE, &limit);
+	rlimit fileLimit{ 16, limit.rlim_max };
+	if (setrlimit(RLIMIT_NOFILE, &fileLimit) == 0) {
+		s_checkReorderWindow(s_randomRanges(&state, 100000, 1000000), 100, true);
+		setrlimit(RLIMIT_NOFILE, &limit);
+	}
+#endif
+
+	std::printf("RangeSweepFuzz: %llu iterations passed\n", iterations);
+	return 0;
+}
+#endif